@@ -78,6 +78,11 @@ namespace reco {
     unsigned int getNeighbour(short x,short y, short z) const;
     void setTime( double time) { time_ = time; }
     void setDepth( int depth) { depth_ = depth; }
+    /// reserve room for n neighbours before adding them one by one
+    void reserveNeighbours(unsigned int n) {
+      neighbours_.reserve(n);
+      neighbourInfos_.reserve(n);
+    }
     void clearNeighbours() {
       neighbours_.clear();
       neighbourInfos_.clear();
@@ -84,35 +84,51 @@ void PFBlock::associatedElements( unsigned i,
   if( i > elements_.size() ) return;
   // assert(i>=0); i >= 0, since i is unsigned
   
-  for(unsigned ie=0; ie<elements_.size(); ie++) {
-    
-    // considered element itself
-    if( ie == i ) {
-      continue;
+  const unsigned size = elements_.size();
+  auto associate = [&](unsigned ie, const Link& link) {
+    // Order the elements by increasing distance !
+
+    double c2=-1;
+    if ( ( (1 << test ) & link.test) !=0 || (test == LINKTEST_ALL) ) 
+      c2= link.distance;
+
+    // not associated
+    if( c2 < 0 ) { 
+      return;
     }
-    // not the right type
+
+    sortedAssociates.insert( pair<double,unsigned>(c2, ie) );
+  };
+
+  // the links to the elements before i are spread over linkData
+  for(unsigned ie=0; ie<i && ie<size; ie++) {
+    // not the right type, checked before the lookup
     if(type !=  PFBlockElement::NONE && 
        elements_[ie].type() != type ) {
       continue;
     }
-
-    // Order the elements by increasing distance !
-
     unsigned index = 0;
     if( !matrix2vector(i, ie, index) ) continue;
-
-    double c2=-1;
     LinkData::const_iterator it =  linkData.find(index);
-    if ( it!=linkData.end() && 
-	 ( ( (1 << test ) & it->second.test) !=0 || (test == LINKTEST_ALL) ) ) 
-      c2= it->second.distance;
+    if ( it!=linkData.end() ) associate(ie, it->second);
+  }
 
-    // not associated
-    if( c2 < 0 ) { 
-      continue;
+  // while the links to the elements after i have consecutive indices: 
+  // walk them in a single pass, still by increasing ie
+  if( i+1 < size ) {
+    unsigned first = 0;
+    matrix2vector(i, i+1, first);
+    LinkData::const_iterator it = linkData.lower_bound(first);
+    const LinkData::const_iterator end = linkData.lower_bound(first+size-i-1);
+    for( ; it != end; ++it ) {
+      const unsigned ie = i+1+(it->first-first);
+      // not the right type
+      if(type !=  PFBlockElement::NONE && 
+         elements_[ie].type() != type ) {
+        continue;
+      }
+      associate(ie, it->second);
     }
-
-    sortedAssociates.insert( pair<double,unsigned>(c2, ie) );
   }
 } 
 
@@ -25,7 +25,7 @@ class DCCFEBlock : public DCCDataBlockPrototype {
 
     DCCFEBlock(DCCDataUnpacker * u,EcalElectronicsMapper * m, DCCEventBlock * e, bool unpack, bool forceToKeepFRdata);
     
-    ~DCCFEBlock() override{ delete [] xtalGains_;}
+    ~DCCFEBlock() override{ delete [] xtalGains_; delete [] xtalSamples_;}
 
     void zsFlag(bool zs){ zs_ = zs;}
 
@@ -43,6 +43,11 @@ class DCCFEBlock : public DCCDataBlockPrototype {
 	 
     virtual int unpackXtalData(unsigned int stripID, unsigned int xtalID){      return BLOCK_UNPACKED;};
     virtual void fillEcalElectronicsError( std::unique_ptr<EcalElectronicsIdCollection> * ){};
+
+    // decodes the nTSamples_ samples following the xtal header word pointed
+    // by xData into xtalSamples_ and xtalGains_ in a single branch-free pass,
+    // returns true if any of them has gain 0
+    bool decodeXtalSamples(const uint16_t * xData);
     
     
     bool zs_;
@@ -64,6 +69,7 @@ class DCCFEBlock : public DCCDataBlockPrototype {
     unsigned int l1_;
     
     short * xtalGains_;
+    uint16_t * xtalSamples_;
     std::unique_ptr<EcalElectronicsIdCollection> * invalidTTIds_;
     std::unique_ptr<EcalElectronicsIdCollection> * invalidZSXtalIds_;
     std::unique_ptr<EcalElectronicsIdCollection> * invalidBlockLengths_;
@@ -2,6 +2,8 @@
 #include "EventFilter/EcalRawToDigi/interface/EcalElectronicsMapper.h"
 #include "EventFilter/EcalRawToDigi/interface/DCCDataUnpacker.h"
 
+#include <algorithm>
+
 #include "FWCore/ParameterSet/interface/ConfigurationDescriptions.h"
 #include "FWCore/ParameterSet/interface/ParameterSetDescription.h"
 
@@ -342,13 +344,26 @@ void EcalRawToDigi::produce(edm::Event& e, const edm::EventSetup& es)
 
   // Step B: encapsulate vectors in actual collections and set unpacker pointers
 
+  // bound the number of digis from the FED payloads, each xtal block being
+  // at least (samples-2)/4+1 words long, so that the collections never grow
+  size_t ebWords(0), eeWords(0);
+  for (std::vector<int>::const_iterator i=fedUnpackList_.begin(); i!=fedUnpackList_.end(); i++) {
+    if (REGIONAL_ && find(FEDS_to_unpack.begin(), FEDS_to_unpack.end(), *i) == FEDS_to_unpack.end()) continue;
+    const size_t words = rawdata->FEDData(*i).size()/8;
+    const int smId = *i - FEDNumbering::MINECALFEDID;
+    if (NUMB_SM_EB_MIN_MIN <= smId && smId <= NUMB_SM_EB_PLU_MAX) ebWords += words;
+    else eeWords += words;
+  }
+  const size_t xtalBlockWords = (myMap_->numbXtalTSamples()-2)/4+1;
+
   // create the collection of Ecal Digis
   auto productDigisEB = std::make_unique<EBDigiCollection>();
-  productDigisEB->reserve(1700);
+  productDigisEB->reserve(std::max<size_t>(1700,ebWords/xtalBlockWords));
   theUnpacker_->setEBDigisCollection(&productDigisEB);
   
   // create the collection of Ecal Digis
   auto productDigisEE = std::make_unique<EEDigiCollection>();
+  productDigisEE->reserve(eeWords/xtalBlockWords);
   theUnpacker_->setEEDigisCollection(&productDigisEE);
   
   // create the collection for headers
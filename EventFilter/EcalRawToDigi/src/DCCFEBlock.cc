@@ -13,6 +13,7 @@ DCCFEBlock::DCCFEBlock( DCCDataUnpacker * u, EcalElectronicsMapper * m, DCCEvent
   numbDWInXtalBlock_         = (expXtalTSamples_-2)/4+1;
   unfilteredDataBlockLength_ = mapper_->getUnfilteredTowerBlockLength();
   xtalGains_                 = new short[expXtalTSamples_]; 
+  xtalSamples_               = new uint16_t[expXtalTSamples_];
   
 }
 
@@ -251,6 +252,23 @@ int DCCFEBlock::unpack(const uint64_t ** data, unsigned int * dwToEnd, bool zs,
 
 
 
+bool DCCFEBlock::decodeXtalSamples(const uint16_t * xData){
+
+  // nTSamples_ == expXtalTSamples_ has been checked in unpack()
+  const uint16_t * samples = xData+1;
+  bool gainZero(false);
+  for(unsigned int i=0; i<nTSamples_; i++){
+    const uint16_t data = samples[i] & TOWER_DIGI_MASK;
+    const short    gain = data>>12;
+    xtalSamples_[i] = data;
+    xtalGains_[i]   = gain;
+    gainZero       |= (gain == 0);
+  }
+  return gainZero;
+}
+
+
+
 void DCCFEBlock::display(std::ostream& o){
 
   o<<"\n Unpacked Info for DCC Tower Block"
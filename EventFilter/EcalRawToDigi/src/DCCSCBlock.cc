@@ -2,6 +2,7 @@
 #include "EventFilter/EcalRawToDigi/interface/DCCEventBlock.h"
 #include "EventFilter/EcalRawToDigi/interface/DCCDataUnpacker.h"
 #include <cstdio>
+#include <algorithm>
 #include "EventFilter/EcalRawToDigi/interface/EcalElectronicsMapper.h"
 
 
@@ -130,8 +131,6 @@ int DCCSCBlock::unpackXtalData(unsigned int expStripID, unsigned int expXtalID){
     }// end else
   }// end if(zs_)
  
-  bool addedFrame=false;
-  
   // if there is an error on xtal id ignore next error checks  
   // otherwise, assume channel_id is valid and proceed with making and checking the data frame
   if(errorOnXtal) return SKIP_BLOCK_UNPACKING;
@@ -140,24 +139,19 @@ int DCCSCBlock::unpackXtalData(unsigned int expStripID, unsigned int expXtalID){
   
   if(pDetId_){// checking that requested EEDetId exists
     
-    (*digis_)->push_back(*pDetId_);
-    EEDataFrame df( (*digis_)->back() );
-    addedFrame=true;
-    bool wrongGain(false);
-    
-    //set samples in the frame
-    for(unsigned int i =0; i< nTSamples_ ;i++){ 
-      xData_++;
-      unsigned int data =  (*xData_) & TOWER_DIGI_MASK;
-      unsigned int gain =  data>>12;
-      xtalGains_[i]=gain;
-      if(gain == 0){          wrongGain = true; }      // although gain==0 found, produce the dataFrame in order to have it, for saturation case
-      df.setSample(i,data);
-    }
+    // decode all the samples at once, the frame is added to the collection
+    // only once it is known to be kept
+    const bool wrongGain = decodeXtalSamples(xData_);
     
-    bool isSaturation(true);
     if(wrongGain){
       
+      // although gain==0 found, produce the dataFrame in order to have it, for saturation case
+      (*digis_)->push_back(*pDetId_);
+      EEDataFrame df( (*digis_)->back() );
+      for(unsigned int i =0; i< nTSamples_ ;i++) df.setSample(i,xtalSamples_[i]);
+      
+      bool isSaturation(true);
+      
       // check whether the gain==0 has features of saturation or not 
       // gain==0 occurs either in case of data corruption or of ADC saturation 
       //                                  \->reject digi            \-> keep digi 
@@ -197,19 +191,14 @@ int DCCSCBlock::unpackXtalData(unsigned int expStripID, unsigned int expXtalID){
       {     
         (*invalidGains_)->push_back(*pDetId_); 
         (*digis_)->pop_back();
-        
-        //return here, so to skip all the rest
-        //make special collection for gain0 data frames (saturation)
-        //Point to begin of next xtal Block
-        data_ += numbDWInXtalBlock_;
-        
-        return BLOCK_UNPACKED;
-        
       }//end isSaturation 
-    else {
-            data_ += numbDWInXtalBlock_;
-            return BLOCK_UNPACKED;
-    }
+    //make special collection for gain0 data frames (saturation)
+
+    //return here, so to skip all the rest
+    //Point to begin of next xtal Block
+    data_ += numbDWInXtalBlock_;
+        
+    return BLOCK_UNPACKED;
     }//end WrongGain
     
     short firstGainWrong=-1;
@@ -231,13 +220,12 @@ int DCCSCBlock::unpackXtalData(unsigned int expStripID, unsigned int expXtalID){
       }
       
       (*invalidGainsSwitch_)->push_back(*pDetId_);
-      
-      errorOnXtal = true;
     }
-    
-    //Add frame to collection only if all data format and gain rules are respected
-    if (errorOnXtal && addedFrame) {
-      (*digis_)->pop_back();
+    else {
+      //Add frame to collection only if all data format and gain rules are respected
+      (*digis_)->push_back(*pDetId_);
+      edm::DataFrame frame( (*digis_)->back() );
+      std::copy(xtalSamples_, xtalSamples_+nTSamples_, frame.begin());
     }
     
   }// End 'if EE id exist'
@@ -135,34 +135,25 @@ int DCCTowerBlock::unpackXtalData(unsigned int expStripID, unsigned int expXtalI
   }// end if (zs_)
 
 
-  bool addedFrame=false;
-
   // if there is an error on xtal id ignore next error checks  
   // otherwise, assume channel_id is valid and proceed with making and checking the data frame
   if(errorOnXtal) return SKIP_BLOCK_UNPACKING;
 
   pDetId_ = (EBDetId*) mapper_->getDetIdPointer(towerId_,stripId,xtalId);
-  (*digis_)->push_back(*pDetId_);
-  EBDataFrame df( (*digis_)->back() );
-  addedFrame=true;
-  bool wrongGain(false);
-
-  //set samples in the data frame
-  for(unsigned int i =0; i< nTSamples_ ;i++){ // loop on samples 
-    xData_++;
-    unsigned int data =  (*xData_) & TOWER_DIGI_MASK;
-    unsigned int gain =  data>>12;
-    xtalGains_[i]=gain;
-    if(gain == 0){ 
-      wrongGain = true; 
-      // although gain==0 found, produce the dataFrame in order to have it, for saturation case
-    } 
-    df.setSample(i,data);
-  }// loop on samples        
 
-  bool isSaturation(true);
+  // decode all the samples at once, the frame is added to the collection
+  // only once it is known to be kept
+  const bool wrongGain = decodeXtalSamples(xData_);
+
   if(wrongGain){
     
+    // although gain==0 found, produce the dataFrame in order to have it, for saturation case
+    (*digis_)->push_back(*pDetId_);
+    EBDataFrame df( (*digis_)->back() );
+    for(unsigned int i =0; i< nTSamples_ ;i++) df.setSample(i,xtalSamples_[i]);
+
+    bool isSaturation(true);
+
     // check whether the gain==0 has features of saturation or not
     // gain==0 occurs either in case of data corruption or of ADC saturation
     //                                  \->reject digi            \-> keep digi
@@ -202,20 +193,15 @@ int DCCTowerBlock::unpackXtalData(unsigned int expStripID, unsigned int expXtalI
       {
         (*invalidGains_)->push_back(*pDetId_);
         (*digis_)->pop_back(); 
-        
-        //Point to begin of next xtal Block
-        data_ += numbDWInXtalBlock_;
-        //return here, so to skip all the rest
-        //make special collection for gain0 data frames when due to saturation
-        return BLOCK_UNPACKED;
-        errorOnXtal = true; //keep it here in case the return is to be dropped
       }//end isSaturation 
-    else {
-        data_ += numbDWInXtalBlock_;
-        return BLOCK_UNPACKED;
-    }
+    //make special collection for gain0 data frames when due to saturation
 
-    }//end WrongGain
+    //Point to begin of next xtal Block
+    data_ += numbDWInXtalBlock_;
+    //return here, so to skip all the rest
+    return BLOCK_UNPACKED;
+
+  }//end WrongGain
   
   
   // from here on, care about gain switches
@@ -237,12 +223,12 @@ int DCCTowerBlock::unpackXtalData(unsigned int expStripID, unsigned int expXtalI
     }
     
     (*invalidGainsSwitch_)->push_back(*pDetId_);
-    errorOnXtal = true;
   }
-  
-  //Add frame to collection only if all data format and gain rules are respected
-  if (errorOnXtal && addedFrame) {
-    (*digis_)->pop_back();
+  else {
+    //Add frame to collection only if all data format and gain rules are respected
+    (*digis_)->push_back(*pDetId_);
+    edm::DataFrame frame( (*digis_)->back() );
+    std::copy(xtalSamples_, xtalSamples_+nTSamples_, frame.begin());
   }
   
   //Point to begin of next xtal Block
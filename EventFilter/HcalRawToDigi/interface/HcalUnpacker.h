@@ -39,6 +39,10 @@ public:
     std::unordered_map<int, QIE10DigiCollection*> qie10Addtl;
     std::unordered_map<int, QIE11DigiCollection*> qie11Addtl;
     HcalUMNioDigi* umnio;
+    // expected number of qie10 and qie11 frames, reserved when the default
+    // collections are created
+    int qie10Reserve;
+    int qie11Reserve;
 
   };
 
@@ -210,6 +210,10 @@ void HcalRawToDigi::produce(edm::Event& e, const edm::EventSetup& es)
   colls.zdcCont=&zdc;
   colls.umnio=&umnio;
   if (unpackTTP_) colls.ttp=&ttp;
+  // the QIE10/QIE11 collections are only created by the unpacker, once the
+  // number of samples is known: pass the same heuristics along
+  if (stats_.max_qie10>0) colls.qie10Reserve=stats_.ave_qie10+(stats_.max_qie10-stats_.ave_qie10)/8;
+  if (stats_.max_qie11>0) colls.qie11Reserve=stats_.ave_qie11+(stats_.max_qie11-stats_.ave_qie11)/8;
 
   // make an entry for each additional qie10 collection that is requested
   for( const auto &info : saveQIE10Info_ ) {
@@ -260,6 +264,12 @@ void HcalRawToDigi::produce(edm::Event& e, const edm::EventSetup& es)
   stats_.ave_tpho=(stats_.ave_tpho*stats_.n+hotp.size())/(stats_.n+1);
   stats_.max_calib=std::max(stats_.max_calib,(int)hc.size());
   stats_.ave_calib=(stats_.ave_calib*stats_.n+hc.size())/(stats_.n+1);
+  const int nqie10 = colls.qie10 ? colls.qie10->size() : 0;
+  stats_.max_qie10=std::max(stats_.max_qie10,nqie10);
+  stats_.ave_qie10=(stats_.ave_qie10*stats_.n+nqie10)/(stats_.n+1);
+  const int nqie11 = colls.qie11 ? colls.qie11->size() : 0;
+  stats_.max_qie11=std::max(stats_.max_qie11,nqie11);
+  stats_.ave_qie11=(stats_.ave_qie11*stats_.n+nqie11)/(stats_.n+1);
 
 
   stats_.n++;
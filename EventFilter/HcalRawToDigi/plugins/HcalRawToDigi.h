@@ -67,6 +67,8 @@ private:
     int max_tp, ave_tp;
     int max_tpho, ave_tpho;
     int max_calib, ave_calib;
+    int max_qie10, ave_qie10;
+    int max_qie11, ave_qie11;
     uint64_t n;
   } stats_;
 };
@@ -614,6 +614,12 @@ void HcalUnpacker::unpackUTCA(const FEDRawData& raw, const HcalElectronicsMap& e
     //use uhtr presamples since amc header not properly packed in simulation
     int nps = uhtr.presamples();
 
+    // the number of samples seldom changes between channels: look up the
+    // matching additional collections only when it does
+    int qie10AddtlNs = -1, qie11AddtlNs = -1;
+    QIE10DigiCollection* qie10AddtlColl = nullptr;
+    QIE11DigiCollection* qie11AddtlColl = nullptr;
+
     HcalUHTRData::const_iterator i=uhtr.begin(), iend=uhtr.end();
     while (i!=iend) {
 #ifdef DebugLog
@@ -639,14 +645,20 @@ void HcalUnpacker::unpackUTCA(const FEDRawData& raw, const HcalElectronicsMap& e
           for (++i; i != iend && !i.isHeader(); ++i) {
               ns++;
           }
+          if (ns != qie11AddtlNs) {
+              auto addtl = colls.qie11Addtl.find( ns );
+              qie11AddtlColl = (addtl == colls.qie11Addtl.end() ? nullptr : addtl->second);
+              qie11AddtlNs = ns;
+          }
           // Check QEI11 container exists
           if (colls.qie11 == nullptr) {
               colls.qie11 = new QIE11DigiCollection(ns);
+              colls.qie11->reserve(colls.qie11Reserve);
           }
           else if (colls.qie11->samples() != ns) {
             // if this sample type hasn't been requested to be saved
             // warn the user to provide a configuration that prompts it to be saved
-            if( colls.qie11Addtl.find( ns ) == colls.qie11Addtl.end() ) {
+            if( qie11AddtlColl == nullptr ) {
               printInvalidDataMessage( "QIE11", colls.qie11->samples(), ns, true );
             }
           }
@@ -659,8 +671,8 @@ void HcalUnpacker::unpackUTCA(const FEDRawData& raw, const HcalElectronicsMap& e
               colls.qie11->addDataFrame(did, head_pos);
             }
             // fill the additional qie11 collections
-            if( colls.qie11Addtl.find( ns ) != colls.qie11Addtl.end() ) {
-              colls.qie11Addtl[ns]->addDataFrame( did, head_pos );
+            if( qie11AddtlColl != nullptr ) {
+              qie11AddtlColl->addDataFrame( did, head_pos );
             }
           } else {
               report.countUnmappedDigi(eid);
@@ -707,13 +719,19 @@ void HcalUnpacker::unpackUTCA(const FEDRawData& raw, const HcalElectronicsMap& e
             printInvalidDataMessage( "QIE10LASMON", colls.qie10Lasermon->samples(), ns, false );
           }
         } else { // these are the default qie10 channels
+          if (ns != qie10AddtlNs) {
+            auto addtl = colls.qie10Addtl.find( ns );
+            qie10AddtlColl = (addtl == colls.qie10Addtl.end() ? nullptr : addtl->second);
+            qie10AddtlNs = ns;
+          }
           if (colls.qie10 == nullptr) { 
 	    colls.qie10 = new QIE10DigiCollection(ns);
+	    colls.qie10->reserve(colls.qie10Reserve);
           }
           else if (colls.qie10->samples() != ns) {
             // if this sample type hasn't been requested to be saved
             // warn the user to provide a configuration that prompts it to be saved
-            if( colls.qie10Addtl.find( ns ) == colls.qie10Addtl.end() ) {
+            if( qie10AddtlColl == nullptr ) {
               printInvalidDataMessage( "QIE10", colls.qie10->samples(), ns, true );
             }
           }
@@ -733,8 +751,8 @@ void HcalUnpacker::unpackUTCA(const FEDRawData& raw, const HcalElectronicsMap& e
             }
               
             // fill the additional qie10 collections
-            if( colls.qie10Addtl.find( ns ) != colls.qie10Addtl.end() ) {
-              colls.qie10Addtl[ns]->addDataFrame( did, head_pos );
+            if( qie10AddtlColl != nullptr ) {
+              qie10AddtlColl->addDataFrame( did, head_pos );
             }
           }
 	} else {
@@ -858,6 +876,8 @@ HcalUnpacker::Collections::Collections() {
   qie10Lasermon=nullptr;
   qie11=nullptr;
   umnio=nullptr;
+  qie10Reserve=0;
+  qie11Reserve=0;
 }
 
 void HcalUnpacker::unpack(const FEDRawData& raw, const HcalElectronicsMap& emap, std::vector<HcalHistogramDigi>& histoDigis) {
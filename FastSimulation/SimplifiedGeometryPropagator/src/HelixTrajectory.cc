@@ -82,7 +82,8 @@ double fastsim::HelixTrajectory::nextCrossingTimeC(const BarrelSimplifiedGeometr
     // b = 2*E*F
     // c = E^2 - G^2
 
-    double E = centerX_*centerX_ + centerY_*centerY_ + radius_*radius_ - layer.getRadius()*layer.getRadius();
+    const double layerRadius = layer.getRadius();
+    double E = centerX_*centerX_ + centerY_*centerY_ + radius_*radius_ - layerRadius*layerRadius;
     double F = 2*centerY_*radius_;
     double G = 2*centerX_*radius_;
 
@@ -113,10 +114,10 @@ double fastsim::HelixTrajectory::nextCrossingTimeC(const BarrelSimplifiedGeometr
     }
 
     // asin is ambiguous, make sure to have the right solution
-    if(std::abs(layer.getRadius() - getRadParticle(phi1)) > 1.0e-2){
+    if(std::abs(layerRadius - getRadParticle(phi1)) > 1.0e-2){
         phi1 = - phi1 + M_PI;
     }
-    if(std::abs(layer.getRadius() - getRadParticle(phi2)) > 1.0e-2){
+    if(std::abs(layerRadius - getRadParticle(phi2)) > 1.0e-2){
         phi2 = - phi2 + M_PI;
     }
 
@@ -128,6 +129,15 @@ double fastsim::HelixTrajectory::nextCrossingTimeC(const BarrelSimplifiedGeometr
         phi2 += 2. * M_PI;
     }
 
+    // positions of the two intersections in the xy plane
+    // (evaluated once, used for the consistency check and the onLayer case below)
+    const double cosPhi1 = std::cos(phi1), sinPhi1 = std::sin(phi1);
+    const double cosPhi2 = std::cos(phi2), sinPhi2 = std::sin(phi2);
+    const double posX1 = centerX_ + radius_*cosPhi1;
+    const double posY1 = centerY_ + radius_*sinPhi1;
+    const double posX2 = centerX_ + radius_*cosPhi2;
+    const double posY2 = centerY_ + radius_*sinPhi2;
+
     // find the corresponding times when the intersection occurs
     // make sure they are positive
     double t1 = (phi1 - phi_)/phiSpeed_;
@@ -144,8 +154,8 @@ double fastsim::HelixTrajectory::nextCrossingTimeC(const BarrelSimplifiedGeometr
     // Check if propagation successful (numerical reasons): both solutions (phi1, phi2) have to be on the layer (same radius)
     // Can happen due to numerical instabilities of geometrical function (if momentum is almost parallel to x/y axis)
     // Get crossingTimeC from StraightTrajectory as good approximation
-    if(std::abs(layer.getRadius() - getRadParticle(phi1)) > 1.0e-2 
-        || std::abs(layer.getRadius() - getRadParticle(phi2)) > 1.0e-2)
+    if(std::abs(layerRadius - std::sqrt(posX1*posX1 + posY1*posY1)) > 1.0e-2 
+        || std::abs(layerRadius - std::sqrt(posX2*posX2 + posY2*posY2)) > 1.0e-2)
     {
         return ((StraightTrajectory*) this)->nextCrossingTimeC(layer, onLayer);
     }
@@ -156,16 +166,16 @@ double fastsim::HelixTrajectory::nextCrossingTimeC(const BarrelSimplifiedGeometr
     {
         bool particleMovesInwards = momentum_.X()*position_.X() + momentum_.Y()*position_.Y() < 0;
 
-        double posX1 = centerX_ + radius_*std::cos(phi1);
-        double posY1 = centerY_ + radius_*std::sin(phi1);
-        double momX1 = momentum_.X()*std::cos(phi1 - phi_) - momentum_.Y()*std::sin(phi1 - phi_);
-        double momY1 = momentum_.X()*std::sin(phi1 - phi_) + momentum_.Y()*std::cos(phi1 - phi_);
+        double cosDeltaPhi1 = std::cos(phi1 - phi_);
+        double sinDeltaPhi1 = std::sin(phi1 - phi_);
+        double momX1 = momentum_.X()*cosDeltaPhi1 - momentum_.Y()*sinDeltaPhi1;
+        double momY1 = momentum_.X()*sinDeltaPhi1 + momentum_.Y()*cosDeltaPhi1;
         bool particleMovesInwards1 = momX1*posX1 + momY1*posY1 < 0;
 
-        double posX2 = centerX_ + radius_*std::cos(phi2);
-        double posY2 = centerY_ + radius_*std::sin(phi2);
-        double momX2 = momentum_.X()*std::cos(phi2 - phi_) - momentum_.Y()*std::sin(phi2 - phi_);
-        double momY2 = momentum_.X()*std::sin(phi2 - phi_) + momentum_.Y()*std::cos(phi2 - phi_);
+        double cosDeltaPhi2 = std::cos(phi2 - phi_);
+        double sinDeltaPhi2 = std::sin(phi2 - phi_);
+        double momX2 = momentum_.X()*cosDeltaPhi2 - momentum_.Y()*sinDeltaPhi2;
+        double momY2 = momentum_.X()*sinDeltaPhi2 + momentum_.Y()*cosDeltaPhi2;
         bool particleMovesInwards2 = momX2*posX2 + momY2*posY2 < 0;
 
         if(particleMovesInwards1 != particleMovesInwards)
@@ -191,6 +201,8 @@ void fastsim::HelixTrajectory::move(double deltaTimeC)
 {
     double deltaT = deltaTimeC/fastsim::Constants::speedOfLight;
     double deltaPhi = phiSpeed_*deltaT;
+    double cosDeltaPhi = std::cos(deltaPhi);
+    double sinDeltaPhi = std::sin(deltaPhi);
     position_.SetXYZT(
        centerX_ + radius_*std::cos(phi_ + deltaPhi),
        centerY_ + radius_*std::sin(phi_ + deltaPhi),
@@ -200,13 +212,15 @@ void fastsim::HelixTrajectory::move(double deltaTimeC)
     // x' = x cos θ - y sin θ
     // y' = x sin θ + y cos θ
     momentum_.SetXYZT(
-       momentum_.X()*std::cos(deltaPhi) - momentum_.Y()*std::sin(deltaPhi),
-       momentum_.X()*std::sin(deltaPhi) + momentum_.Y()*std::cos(deltaPhi),
+       momentum_.X()*cosDeltaPhi - momentum_.Y()*sinDeltaPhi,
+       momentum_.X()*sinDeltaPhi + momentum_.Y()*cosDeltaPhi,
        momentum_.Z(),
        momentum_.E());
 }
 
 double fastsim::HelixTrajectory::getRadParticle(double phi) const
 {
-    return sqrt((centerX_ + radius_*std::cos(phi))*(centerX_ + radius_*std::cos(phi)) + (centerY_ + radius_*std::sin(phi))*(centerY_ + radius_*std::sin(phi)));
+    double x = centerX_ + radius_*std::cos(phi);
+    double y = centerY_ + radius_*std::sin(phi);
+    return sqrt(x*x + y*y);
 }
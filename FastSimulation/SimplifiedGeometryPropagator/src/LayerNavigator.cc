@@ -1,7 +1,7 @@
 #include "FastSimulation/SimplifiedGeometryPropagator/interface/LayerNavigator.h"
 #include "FastSimulation/SimplifiedGeometryPropagator/interface/Constants.h"
 
-#include <vector>
+#include <array>
 
 #include "FWCore/MessageLogger/interface/MessageLogger.h"
 
@@ -200,37 +200,39 @@ bool fastsim::LayerNavigator::moveParticleToNextLayer(fastsim::Particle & partic
     // calculate and store some variables related to the particle's trajectory
     std::unique_ptr<fastsim::Trajectory> trajectory = Trajectory::createTrajectory(particle,magneticFieldZ);
     
-    // push back all possible candidates
-    std::vector<const fastsim::SimplifiedGeometry*> layers;
+    // collect all possible candidates (at most 3, no heap allocation per step)
+    std::array<const fastsim::SimplifiedGeometry*,3> layers;
+    unsigned nLayers = 0;
     if(nextBarrelLayer_) 
     {
-        layers.push_back(nextBarrelLayer_);
+        layers[nLayers++] = nextBarrelLayer_;
     }
     if(previousBarrelLayer_)
     {
-        layers.push_back(previousBarrelLayer_);
+        layers[nLayers++] = previousBarrelLayer_;
     }
 
     if(particle.momentum().Z() > 0)
     {
         if(nextForwardLayer_)
         {
-            layers.push_back(nextForwardLayer_);
+            layers[nLayers++] = nextForwardLayer_;
         }
     }
     else
     {
         if(previousForwardLayer_)
         {
-            layers.push_back(previousForwardLayer_);
+            layers[nLayers++] = previousForwardLayer_;
         }
     }
 
     // calculate time until each possible intersection
     // -> pick layer that is hit first    
     double deltaTimeC = -1;
-    for(auto _layer : layers)
+    for(unsigned i = 0; i < nLayers; ++i)
     {
+        const fastsim::SimplifiedGeometry * _layer = layers[i];
         double tempDeltaTime = trajectory->nextCrossingTimeC(*_layer, particle.isOnLayer(_layer->isForward(), _layer->index()));
         LogDebug(MESSAGECATEGORY) << "   particle crosses layer " << *_layer << " in time " << tempDeltaTime;
         if(tempDeltaTime > 0 && (layer == nullptr || tempDeltaTime<deltaTimeC || deltaTimeC < 0))
@@ -65,24 +65,24 @@ std::unique_ptr<fastsim::Particle> fastsim::ParticleManager::nextParticle(const
 {
     std::unique_ptr<fastsim::Particle> particle;
 
-    // retrieve particle from buffer
-    if(!particleBuffer_.empty())
+    // skip particles that are not accepted by the filter
+    // (iteratively: events with many rejected secondaries would otherwise recurse deeply)
+    do
     {
-        particle = std::move(particleBuffer_.back());
-        particleBuffer_.pop_back();
-    }
-    // or from genParticle list
-    else
-    {
-       particle = nextGenParticle();
-       if(!particle) return nullptr;
-    }
-
-    // if filter does not accept, skip particle
-    if(!particleFilter_->accepts(*particle))
-    {
-        return nextParticle(random);
+        // retrieve particle from buffer
+        if(!particleBuffer_.empty())
+        {
+            particle = std::move(particleBuffer_.back());
+            particleBuffer_.pop_back();
+        }
+        // or from genParticle list
+        else
+        {
+           particle = nextGenParticle();
+           if(!particle) return nullptr;
+        }
     }
+    while(!particleFilter_->accepts(*particle));
 
     // lifetime or charge of particle are not yet set
     if(!particle->remainingProperLifeTimeIsSet() || !particle->chargeIsSet())
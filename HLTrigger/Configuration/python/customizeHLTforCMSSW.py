@@ -189,10 +189,26 @@ def customiseForEcalTestPR22254thresholdC(process):
 
 
 
+# DA_vect vertex clustering: new mandatory parameters zrange (0 = dense track-cluster sums),
+# runInParallel and blockSize
+def customiseForDAClusterizerZrange(process):
+    for producer in producers_by_type(process, "PrimaryVertexProducer"):
+        if producer.TkClusParameters.algorithm.value() == "DA_vect":
+            pset = producer.TkClusParameters.TkDAClusParameters
+            if not hasattr(pset, "zrange"):
+                pset.zrange = cms.double(0.)
+            if not hasattr(pset, "runInParallel"):
+                pset.runInParallel = cms.bool(False)
+            if not hasattr(pset, "blockSize"):
+                pset.blockSize = cms.uint32(512)
+    return process
+
+
 # CMSSW version specific customizations
 def customizeHLTforCMSSW(process, menuType="GRun"):
 
     # add call to action function in proper order: newest last!
     # process = customiseFor12718(process)
+    process = customiseForDAClusterizerZrange(process)
 
     return process
@@ -0,0 +1,180 @@
+#include "IOMC/RandomEngine/src/PhiloxEngine.h"
+#include "FWCore/Utilities/interface/EDMException.h"
+
+#include "CLHEP/Random/engineIDulong.h"
+
+#include <fstream>
+#include <iostream>
+
+namespace edm {
+
+  namespace {
+    constexpr std::uint32_t kPhiloxM0 = 0xD2511F53U;
+    constexpr std::uint32_t kPhiloxM1 = 0xCD9E8D57U;
+    constexpr std::uint32_t kPhiloxW0 = 0x9E3779B9U;
+    constexpr std::uint32_t kPhiloxW1 = 0xBB67AE85U;
+    constexpr unsigned int kPhiloxRounds = 10;
+
+    // 53 bit double from two 32 bit words, shifted by half a step to stay inside ]0,1[
+    inline double toDouble(std::uint32_t a, std::uint32_t b) {
+      std::uint64_t const mantissa = (static_cast<std::uint64_t>(a >> 5) << 26) | (b >> 6);
+      return (static_cast<double>(mantissa) + 0.5) * (1.0 / 9007199254740992.0);
+    }
+
+    inline void increment(std::array<std::uint32_t, 4>& c) {
+      for(auto& w : c) {
+        if(++w != 0) return;
+      }
+    }
+
+    inline void decrement(std::array<std::uint32_t, 4>& c) {
+      for(auto& w : c) {
+        if(w-- != 0) return;
+      }
+    }
+  }
+
+  PhiloxEngine::PhiloxEngine() {
+    setSeed(0, 0);
+  }
+
+  PhiloxEngine::PhiloxEngine( long seed ) {
+    setSeed(seed, 0);
+  }
+
+  PhiloxEngine::~PhiloxEngine() {
+  }
+
+  PhiloxEngine::Block
+  PhiloxEngine::generate(Block c, Key k) {
+    for(unsigned int round = 0; round < kPhiloxRounds; ++round) {
+      std::uint64_t const p0 = static_cast<std::uint64_t>(kPhiloxM0) * c[0];
+      std::uint64_t const p1 = static_cast<std::uint64_t>(kPhiloxM1) * c[2];
+      c = {{ static_cast<std::uint32_t>(p1 >> 32) ^ c[1] ^ k[0],
+             static_cast<std::uint32_t>(p1),
+             static_cast<std::uint32_t>(p0 >> 32) ^ c[3] ^ k[1],
+             static_cast<std::uint32_t>(p0) }};
+      k[0] += kPhiloxW0;
+      k[1] += kPhiloxW1;
+    }
+    return c;
+  }
+
+  void PhiloxEngine::refill() {
+    output_ = generate(counter_, key_);
+    increment(counter_);
+    index_ = 0;
+  }
+
+  double PhiloxEngine::flat() {
+    std::uint32_t const a = nextWord();
+    std::uint32_t const b = nextWord();
+    return toDouble(a, b);
+  }
+
+  void PhiloxEngine::flatArray(int const size, double* vect) {
+    int i = 0;
+    // use up a partially consumed block first, the sequence is the same as repeated flat()
+    for(; i < size && index_ != 4; ++i) vect[i] = flat();
+    // then whole blocks, which do not depend on each other
+    for(; i + 1 < size; i += 2) {
+      Block const out = generate(counter_, key_);
+      increment(counter_);
+      vect[i] = toDouble(out[0], out[1]);
+      vect[i + 1] = toDouble(out[2], out[3]);
+    }
+    if(i < size) vect[i] = flat();
+  }
+
+  void PhiloxEngine::setSeed(long seed, int) {
+    theSeed = seed;
+    key_ = {{ static_cast<std::uint32_t>(seed), 0U }};
+    counter_ = {{ 0U, 0U, 0U, 0U }};
+    index_ = 4;
+  }
+
+  void PhiloxEngine::setSeeds(long const* seeds, int) {
+    setSeed(seeds[0], 0);
+  }
+
+  void PhiloxEngine::setEvent(std::uint32_t seed, std::uint32_t run, std::uint32_t lumi, std::uint64_t event) {
+    theSeed = seed;
+    key_ = {{ seed, run }};
+    counter_ = {{ 0U, lumi, static_cast<std::uint32_t>(event), static_cast<std::uint32_t>(event >> 32) }};
+    index_ = 4;
+  }
+
+  void PhiloxEngine::saveStatus(char const filename[]) const {
+    std::ofstream outFile(filename, std::ios::out);
+    put(outFile);
+  }
+
+  void PhiloxEngine::restoreStatus(char const filename[]) {
+    std::ifstream inFile(filename, std::ios::in);
+    if(!inFile) {
+      throw edm::Exception(edm::errors::FileOpenError)
+        << "PhiloxEngine::restoreStatus: cannot open file \"" << filename << "\"\n";
+    }
+    get(inFile);
+  }
+
+  void PhiloxEngine::showStatus() const {
+    std::cout << "--------- Philox4x32 engine status ---------\n"
+              << " key     = " << key_[0] << " " << key_[1] << "\n"
+              << " counter = " << counter_[0] << " " << counter_[1] << " "
+              << counter_[2] << " " << counter_[3] << "\n"
+              << " word    = " << index_ << "\n"
+              << "--------------------------------------------" << std::endl;
+  }
+
+  std::vector<unsigned long> PhiloxEngine::put() const {
+    std::vector<unsigned long> v;
+    v.reserve(kStateSize);
+    v.push_back(CLHEP::engineIDulong<PhiloxEngine>());
+    for(auto k : key_) v.push_back(k);
+    for(auto c : counter_) v.push_back(c);
+    v.push_back(index_);
+    return v;
+  }
+
+  bool PhiloxEngine::get(std::vector<unsigned long> const& v) {
+    if(v.size() != kStateSize) return false;
+    if(v[0] != CLHEP::engineIDulong<PhiloxEngine>()) return false;
+    if(v[7] > 4) return false;
+    key_ = {{ static_cast<std::uint32_t>(v[1]), static_cast<std::uint32_t>(v[2]) }};
+    counter_ = {{ static_cast<std::uint32_t>(v[3]), static_cast<std::uint32_t>(v[4]),
+                  static_cast<std::uint32_t>(v[5]), static_cast<std::uint32_t>(v[6]) }};
+    index_ = v[7];
+    // the current block is not saved, it is the one before counter_
+    if(index_ != 4) {
+      Block c = counter_;
+      decrement(c);
+      output_ = generate(c, key_);
+    }
+    return true;
+  }
+
+  std::ostream& PhiloxEngine::put(std::ostream& os) const {
+    os << engineName() << "\n";
+    for(auto value : put()) os << value << "\n";
+    return os;
+  }
+
+  std::istream& PhiloxEngine::get(std::istream& is) {
+    std::string tag;
+    is >> tag;
+    if(tag != engineName()) {
+      is.clear(std::ios::badbit | is.rdstate());
+      return is;
+    }
+    return getState(is);
+  }
+
+  std::istream& PhiloxEngine::getState(std::istream& is) {
+    std::vector<unsigned long> v(kStateSize);
+    for(auto& value : v) is >> value;
+    if(!is || !get(v)) is.clear(std::ios::badbit | is.rdstate());
+    return is;
+  }
+
+}  // namespace edm
@@ -0,0 +1,98 @@
+#ifndef IOMC_RandomEngine_PhiloxEngine_h
+#define IOMC_RandomEngine_PhiloxEngine_h
+
+/** \class edm::PhiloxEngine
+
+ Description: Counter-based Philox4x32-10 engine behind the CLHEP interface
+
+ The output is a pure function of a 64 bit key and a 128 bit counter
+ (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC11).
+ The key is taken from the seed and the run number, the upper three
+ words of the counter from the luminosity block and event number, so
+ that the RandomNumberGeneratorService can position the engine of a
+ module at the start of a given event independently of which stream
+ processes it and of what was drawn before. The lowest counter word
+ numbers the blocks of four 32 bit words drawn within the event.
+
+ flatArray() fills whole blocks directly and is the preferred way to
+ draw many numbers at once.
+*/
+
+#include "CLHEP/Random/RandomEngine.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace edm {
+
+  class PhiloxEngine : public CLHEP::HepRandomEngine {
+
+  public:
+    // Constructors and destructor.
+    PhiloxEngine();
+    PhiloxEngine( long seed );
+    ~PhiloxEngine() override;
+
+    // Returns a pseudo random number in ]0,1[ with 53 bits of precision.
+    double flat() override;
+
+    // Fills an array "vect" of specified size with flat random values.
+    void flatArray(int const size, double* vect) override;
+
+    // Sets the key from the seed and rewinds the counter.
+    void setSeed(long seed, int) override;
+
+    // Only the first seed of the zero terminated array is used.
+    void setSeeds(long const* seeds, int) override;
+
+    // Positions the engine at the start of the sequence reserved for one event.
+    void setEvent(std::uint32_t seed, std::uint32_t run, std::uint32_t lumi, std::uint64_t event);
+
+    void saveStatus(char const filename[] = "Philox.conf") const override;
+    void restoreStatus(char const filename[] = "Philox.conf") override;
+    void showStatus() const override;
+
+    // Returns a float flat ]0,1[
+    operator float() override { return (float)flat(); }
+
+    // Returns an unsigned int (32-bit) flat
+    operator unsigned int() override { return nextWord(); }
+
+    std::ostream & put(std::ostream & os) const override;
+    std::istream & get(std::istream & is) override;
+    std::istream & getState(std::istream & is) override;
+
+    // Returns the engine name as a string
+    std::string name() const override { return engineName(); }
+    static std::string engineName() { return std::string("Philox4x32"); }
+
+    std::vector<unsigned long> put() const override;
+    bool get(std::vector<unsigned long> const& v) override;
+    bool getState(std::vector<unsigned long> const& v) override { return get(v); }
+
+  private:
+    typedef std::array<std::uint32_t, 4> Block;
+    typedef std::array<std::uint32_t, 2> Key;
+
+    static constexpr unsigned int kStateSize = 8; // engine ID, key, counter, position
+
+    static Block generate(Block counter, Key key);
+
+    void refill();
+    std::uint32_t nextWord() {
+      if(index_ == 4) refill();
+      return output_[index_++];
+    }
+
+    Key key_;
+    Block counter_;   // counter of the next block to generate
+    Block output_;    // current block of output
+    unsigned int index_; // next unused word of output_, 4 when exhausted
+
+  }; // PhiloxEngine
+
+}  // namespace edm
+
+#endif // IOMC_RandomEngine_PhiloxEngine_h
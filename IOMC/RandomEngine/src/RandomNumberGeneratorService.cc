@@ -34,6 +34,7 @@
 #include "FWCore/Utilities/interface/Exception.h"
 #include "FWCore/Utilities/interface/LuminosityBlockIndex.h"
 #include "FWCore/Utilities/interface/StreamID.h"
+#include "IOMC/RandomEngine/src/PhiloxEngine.h"
 #include "IOMC/RandomEngine/src/TRandomAdaptor.h"
 #include "SimDataFormats/RandomEngine/interface/RandomEngineState.h"
 #include "SimDataFormats/RandomEngine/interface/RandomEngineStates.h"
@@ -151,7 +152,7 @@ namespace edm {
         else {
           if(initialSeedSet.size() != 1U) {
             throw Exception(errors::Configuration)
-              << "Random engines of type \"HepJamesRandom\", \"TRandom3\" and \"MixMaxRng\" \n"
+              << "Random engines of type \"HepJamesRandom\", \"TRandom3\", \"MixMaxRng\" and \"Philox4x32\" \n"
               << "require exactly 1 seed be specified in the configuration.\n"
               << "There were " << initialSeedSet.size() << " seeds set for the\n"
               << "module with label \"" << label << "\".\n" ;
@@ -180,6 +181,14 @@ namespace edm {
                    "configuration file was " << initialSeedSet[0] << ".  This was for \n"
                 << "the module with label " << label << ".\n";
             }
+          } else if(engineName == "Philox4x32") {
+            if(initialSeedSet[0] > maxSeedTRandom3) {
+              throw Exception(errors::Configuration)
+                << "The Philox4x32 engine seed should be in the range 0 to " << maxSeedTRandom3 << ".\n"
+                << "The seed passed to the RandomNumberGenerationService from the\n"
+                   "configuration file was " << initialSeedSet[0] << ".  This was for \n"
+                << "the module with label " << label << ".\n";
+            }
           } else {
             throw Exception(errors::Configuration)
               << "The random engine name, \"" << engineName
@@ -451,6 +460,9 @@ namespace edm {
         restoreFromCache(eventCache_[event.streamID()], streamEngines_[event.streamID()]);
 
       } else {
+        // counter-based engines start each event at a position fixed by the event itself
+        positionEnginesForEvent(event);
+
         // copy from engines to event cache
         snapShot(streamEngines_[event.streamID()], eventCache_[event.streamID()]);
       }
@@ -576,6 +588,8 @@ namespace edm {
             os << "  " << i.engine()->getSeed();
           } else if(i.engine()->name() == std::string("MixMaxRng")) {
             os << "  " << i.engine()->getSeed();
+          } else if(i.engine()->name() == PhiloxEngine::engineName()) {
+            os << "  " << i.engine()->getSeed();
           } else {
             os << "  engine does not know seeds";
           }
@@ -597,6 +611,8 @@ namespace edm {
             os << "  " << i.engine()->getSeed();
           } else if(i.engine()->name() == std::string("MixMaxRng")) {
             os << "  " << i.engine()->getSeed();
+          } else if(i.engine()->name() == PhiloxEngine::engineName()) {
+            os << "  " << i.engine()->getSeed();
           } else {
             os << "  engine does not know seeds";
           }
@@ -783,6 +799,15 @@ namespace edm {
           engine->setSeed(engineSeedsL[0], 0);
           engine->get(engineStateL);
 
+          labelAndEngine->setSeed(engineSeeds[0], 0);
+        } else if(engineStateL[0] == CLHEP::engineIDulong<PhiloxEngine>()) {
+
+          checkEngineType(engine->name(), PhiloxEngine::engineName(), engineLabel);
+
+          // This line actually restores the engine state, key and counter included.
+          engine->setSeed(engineSeedsL[0], 0);
+          engine->get(engineStateL);
+
           labelAndEngine->setSeed(engineSeeds[0], 0);
         } else if(engineStateL[0] == CLHEP::engineIDulong<TRandomAdaptor>()) {
 
@@ -1153,6 +1178,12 @@ namespace edm {
               if(seedOffset != 0 || eventSeedOffset != 0) {
                 resetEngineSeeds(engines.back(), name, seeds, seedOffset, eventSeedOffset);
               }
+            } else if(name == "Philox4x32") {
+              std::shared_ptr<CLHEP::HepRandomEngine> engine = std::make_shared<PhiloxEngine>(seedL);
+              engines.emplace_back(label, seeds, engine);
+              if(seedOffset != 0 || eventSeedOffset != 0) {
+                resetEngineSeeds(engines.back(), name, seeds, seedOffset, eventSeedOffset);
+              }
             } else { // TRandom3, currently the only other possibility
 
               // There is a dangerous conversion from std::uint32_t to long
@@ -1178,6 +1209,21 @@ namespace edm {
       std::sort(moduleIDVector.begin(), moduleIDVector.end());
     }
 
+    void
+    RandomNumberGeneratorService::positionEnginesForEvent(Event const& event) {
+      // The key uses the configured seed plus eventSeedOffset but not the stream
+      // offset, so the numbers an event gets do not depend on the stream it runs on.
+      for(auto& labelAndEngine : streamEngines_[event.streamID()]) {
+        if(labelAndEngine.engine()->name() != PhiloxEngine::engineName()) continue;
+        VUint32 const& seeds = seedsAndNameMap_.find(labelAndEngine.label())->second.seeds();
+        std::uint32_t seed0 = seeds[0] + eventSeedOffset_; // wraps around at 32 bits
+        static_cast<PhiloxEngine&>(*labelAndEngine.engine()).setEvent(seed0,
+                                                                      event.id().run(),
+                                                                      event.id().luminosityBlock(),
+                                                                      event.id().event());
+      }
+    }
+
     void
     RandomNumberGeneratorService::resetEngineSeeds(LabelAndEngine& labelAndEngine,
                                                    std::string const& engineName,
@@ -1214,7 +1260,7 @@ namespace edm {
           long int seedL = static_cast<long int>(seed0);
           labelAndEngine.engine()->setSeed(seedL, 0);
         } else {
-          assert(engineName == "TRandom3");
+          assert(engineName == "TRandom3" || engineName == "Philox4x32");
           // Wrap around if the offsets push the seed over the maximum allowed value
           // We have to be extra careful with this one because it may also go beyond
           // the values 32 bits can hold
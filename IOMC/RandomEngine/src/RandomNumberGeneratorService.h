@@ -199,6 +199,8 @@ namespace edm {
                                  unsigned int eventSeedOffset,
                                  std::vector<ModuleIDToEngine>& moduleIDVector);
 
+      void positionEnginesForEvent(Event const& event);
+
       void resetEngineSeeds(LabelAndEngine& labelAndEngine,
                             std::string const& engineName,
                             VUint32 const& seeds,
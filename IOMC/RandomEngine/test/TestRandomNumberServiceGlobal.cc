@@ -22,7 +22,9 @@ and do a comparison with the numbers the engines from
 the service actually generate. This does not work to test
 multistream replay jobs because we do not know which
 streams will contain which events so this check is not done
-in those cases.
+in those cases. The exception is the Philox4x32 engine, which
+the service positions from the event number, so its numbers
+are checked event by event in all jobs.
 
 Creates a set of text file with names like the following:
 testRandomService_0_t1.txt where the first number is the stream
@@ -65,6 +67,7 @@ the text file containing the states.
 #include "FWCore/Utilities/interface/Exception.h"
 #include "FWCore/Utilities/interface/RandomNumberGenerator.h"
 #include "FWCore/Utilities/interface/propagate_const.h"
+#include "IOMC/RandomEngine/src/PhiloxEngine.h"
 #include "IOMC/RandomEngine/src/TRandomAdaptor.h"
 
 #include "CLHEP/Random/RandExponential.h"
@@ -232,7 +235,28 @@ TestRandomNumberServiceGlobal::analyze(edm::StreamID streamID, edm::Event const&
   cache->outFile_ << randomNumberEvent2_ << "\n";
   cache->outFile_ << randomNumberEvent3_ << "\n";
 
-  if(!multiStreamReplay_) {
+  if(engineName_ == "Philox4x32") {
+    // The engine is positioned from the event number, so the reference
+    // does not depend on the stream or on the events seen before
+    edm::PhiloxEngine referenceEngine;
+    referenceEngine.setEvent(seeds_.at(0) + offset_,
+                             event.eventAuxiliary().run(),
+                             event.eventAuxiliary().luminosityBlock(),
+                             event.eventAuxiliary().event());
+    double y0 = referenceEngine.flat();
+    double y1 = referenceEngine.flat();
+    double y2 = referenceEngine.flat();
+    CLHEP::RandExponential referenceDist(referenceEngine);
+    double y3 = referenceDist.fire(mean);
+    if(randomNumberEvent0_ != y0 ||
+       randomNumberEvent1_ != y1 ||
+       randomNumberEvent2_ != y2 ||
+       randomNumberEvent3_ != y3) {
+      throw cms::Exception("TestRandomNumberService")
+        << "TestRandomNumberServiceGlobal::analyze: Random sequence does not match expected sequence for "
+        << event.eventAuxiliary().id();
+    }
+  } else if(!multiStreamReplay_) {
     // Compare with the reference numbers when not skipping events at the beginning
     if(skippedEvents_.size() == 1 && skippedEvents_[0] == 0) {
       if(randomNumberEvent0_ != cache->referenceRandomNumbers_.at(0 + 4 * cache->countEvents_) ||
@@ -360,6 +384,8 @@ TestRandomNumberServiceGlobal::globalBeginLuminosityBlock(edm::LuminosityBlock c
       lumiCache->referenceEngine_ = std::shared_ptr<CLHEP::HepRandomEngine>(new CLHEP::HepJamesRandom(seedL)); // propagate_const<T> has no reset() function
     } else if(engineName_ == "MixMaxRng") {
       lumiCache->referenceEngine_ = std::shared_ptr<CLHEP::HepRandomEngine>(new CLHEP::MixMaxRng(seedL)); // propagate_const<T> has no reset() function
+    } else if(engineName_ == "Philox4x32") {
+      lumiCache->referenceEngine_ = std::shared_ptr<CLHEP::HepRandomEngine>(new edm::PhiloxEngine(seedL)); // propagate_const<T> has no reset() function
     } else {
       lumiCache->referenceEngine_ = std::shared_ptr<CLHEP::HepRandomEngine>(new edm::TRandomAdaptor(seedL)); // propagate_const<T> has no reset() function
     }
@@ -404,6 +430,11 @@ TestRandomNumberServiceGlobal::beginStream(edm::StreamID streamID) const {
   std::string outFileName = std::string("testRandomService") + suffix.str() + std::string(".txt");
   streamCache->outFile_.open(outFileName.c_str(), std::ofstream::out);
 
+  // The Philox4x32 reference is made per event in analyze
+  if(engineName_ == "Philox4x32") {
+    return streamCache;
+  }
+
   if(engineName_ == "RanecuEngine") {
     streamCache->referenceEngine_ = std::shared_ptr<CLHEP::HepRandomEngine>(new CLHEP::RanecuEngine()); // propagate_const<T> has no reset() function
     long int seedL[2];
@@ -0,0 +1,139 @@
+// Unit test of edm::PhiloxEngine: known-answer vectors of Philox4x32-10
+// (Salmon et al., SC11, Random123 kat_vectors), flatArray() against
+// repeated flat() and saving and restoring the engine state.
+
+#include "IOMC/RandomEngine/src/PhiloxEngine.h"
+
+#include "CLHEP/Random/engineIDulong.h"
+
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+  unsigned int nFailures = 0;
+
+  void check(bool ok, char const* what) {
+    if(!ok) {
+      std::cerr << "testPhiloxEngine: FAILED " << what << std::endl;
+      ++nFailures;
+    }
+  }
+
+  // Puts the engine at the start of the block generated from counter c with key k
+  void setBlock(edm::PhiloxEngine& engine, std::uint32_t const k[2], std::uint32_t const c[4]) {
+    std::vector<unsigned long> state{CLHEP::engineIDulong<edm::PhiloxEngine>(),
+                                     k[0], k[1], c[0], c[1], c[2], c[3], 4};
+    check(engine.get(state), "get() of a valid state");
+  }
+
+  bool nextBlockIs(edm::PhiloxEngine& engine, std::uint32_t const expected[4]) {
+    bool ok = true;
+    for(unsigned int i = 0; i < 4; ++i) {
+      ok = ok && static_cast<unsigned int>(engine) == expected[i];
+    }
+    return ok;
+  }
+
+  void testKnownAnswers() {
+    struct Vector {
+      std::uint32_t counter[4];
+      std::uint32_t key[2];
+      std::uint32_t expected[4];
+    };
+    Vector const vectors[] = {
+      {{0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U},
+       {0x00000000U, 0x00000000U},
+       {0x6627e8d5U, 0xe169c58dU, 0xbc57ac4cU, 0x9b00dbd8U}},
+      {{0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU},
+       {0xffffffffU, 0xffffffffU},
+       {0x408f276dU, 0x41c83b0eU, 0xa20bc7c6U, 0x6d5451fdU}},
+      {{0x243f6a88U, 0x85a308d3U, 0x13198a2eU, 0x03707344U},
+       {0xa4093822U, 0x299f31d0U},
+       {0xd16cfe09U, 0x94fdccebU, 0x5001e420U, 0x24126ea1U}}
+    };
+    for(auto const& v : vectors) {
+      edm::PhiloxEngine engine;
+      setBlock(engine, v.key, v.counter);
+      check(nextBlockIs(engine, v.expected), "known-answer vector");
+    }
+
+    // seed 0 starts at counter 0 with key 0, so does event 0 of run 0
+    edm::PhiloxEngine seeded(0);
+    check(nextBlockIs(seeded, vectors[0].expected), "known-answer vector after setSeed");
+    edm::PhiloxEngine positioned(12345);
+    positioned.flat();
+    positioned.setEvent(0, 0, 0, 0);
+    check(nextBlockIs(positioned, vectors[0].expected), "known-answer vector after setEvent");
+  }
+
+  // Compares flatArray() with flat() after drawing nWords 32 bit words from both engines
+  void testFlatArray(unsigned int nWords, int size) {
+    edm::PhiloxEngine a(4357);
+    edm::PhiloxEngine b(4357);
+    a.setEvent(4357, 1, 2, 3);
+    b.setEvent(4357, 1, 2, 3);
+    for(unsigned int i = 0; i < nWords; ++i) {
+      static_cast<unsigned int>(a);
+      static_cast<unsigned int>(b);
+    }
+    std::vector<double> array(size);
+    a.flatArray(size, array.data());
+    bool ok = true;
+    for(int i = 0; i < size; ++i) {
+      ok = ok && array[i] == b.flat();
+    }
+    // both engines must also continue from the same position
+    ok = ok && a.flat() == b.flat();
+    check(ok, "flatArray() against repeated flat()");
+  }
+
+  void testSaveRestore() {
+    edm::PhiloxEngine engine(17);
+    engine.setEvent(17, 1, 1, 42);
+    // stop in the middle of a block
+    engine.flat();
+    static_cast<unsigned int>(engine);
+
+    std::vector<unsigned long> state = engine.put();
+    std::ostringstream os;
+    engine.put(os);
+
+    std::vector<double> expected(7);
+    engine.flatArray(7, expected.data());
+
+    edm::PhiloxEngine fromVector;
+    check(fromVector.get(state), "get() of the put() state");
+    bool ok = true;
+    for(double x : expected) ok = ok && fromVector.flat() == x;
+    check(ok, "put()/get() round trip");
+
+    edm::PhiloxEngine fromStream;
+    std::istringstream is(os.str());
+    fromStream.get(is);
+    check(!is.fail(), "get(std::istream&) of the put(std::ostream&) state");
+    ok = true;
+    for(double x : expected) ok = ok && fromStream.flat() == x;
+    check(ok, "put(std::ostream&)/get(std::istream&) round trip");
+
+    state[0] = 0;
+    check(!fromVector.get(state), "get() of a state with the wrong engine ID");
+  }
+}
+
+int main() {
+  testKnownAnswers();
+  for(unsigned int nWords = 0; nWords < 4; ++nWords) {
+    for(int size : {0, 1, 2, 5, 8, 9}) {
+      testFlatArray(nWords, size);
+    }
+  }
+  testSaveRestore();
+  if(nFailures != 0) {
+    std::cerr << "testPhiloxEngine: " << nFailures << " failures" << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,49 @@
+import FWCore.ParameterSet.Config as cms
+
+process = cms.Process("TEST")
+
+process.options = cms.untracked.PSet(
+    numberOfStreams = cms.untracked.uint32(3)
+)
+
+process.source = cms.Source("PoolSource",
+    fileNames = cms.untracked.vstring(
+        'file:testPhiloxMultiStream.root'
+    ),
+    firstRun = cms.untracked.uint32(1),
+    firstEvent = cms.untracked.uint32(3)
+)
+
+process.RandomNumberGeneratorService = cms.Service("RandomNumberGeneratorService",
+
+    t1 = cms.PSet(
+        initialSeed = cms.untracked.uint32(7),
+        engineName = cms.untracked.string('Philox4x32')
+    ),
+    t2 = cms.PSet(
+        initialSeed = cms.untracked.uint32(7),
+        engineName = cms.untracked.string('Philox4x32')
+    ),
+    enableChecking = cms.untracked.bool(True),
+    verbose = cms.untracked.bool(False),
+    restoreStateTag = cms.untracked.InputTag('randomEngineStateProducer')
+)
+
+process.t1 = cms.EDAnalyzer("TestRandomNumberServiceGlobal",
+                            engineName = cms.untracked.string('Philox4x32'),
+                            seeds = cms.untracked.vuint32(91),
+                            offset = cms.untracked.uint32(0),
+                            maxEvents = cms.untracked.uint32(5),
+                            nStreams = cms.untracked.uint32(3),
+                            multiStreamReplay = cms.untracked.bool(True)
+)
+process.t2 = cms.EDAnalyzer("TestRandomNumberServiceGlobal",
+                            engineName = cms.untracked.string('Philox4x32'),
+                            seeds = cms.untracked.vuint32(92),
+                            offset = cms.untracked.uint32(0),
+                            maxEvents = cms.untracked.uint32(5),
+                            nStreams = cms.untracked.uint32(3),
+                            multiStreamReplay = cms.untracked.bool(True)
+)
+
+process.p = cms.Path(process.t1+process.t2)
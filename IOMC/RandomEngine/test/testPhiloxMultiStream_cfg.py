@@ -0,0 +1,57 @@
+import FWCore.ParameterSet.Config as cms
+
+process = cms.Process("PROD")
+
+process.options = cms.untracked.PSet(
+    numberOfStreams = cms.untracked.uint32(3)
+)
+
+process.RandomNumberGeneratorService = cms.Service("RandomNumberGeneratorService",
+
+    t1 = cms.PSet(
+        initialSeed = cms.untracked.uint32(91),
+        engineName = cms.untracked.string('Philox4x32')
+    ),
+    t2 = cms.PSet(
+        initialSeed = cms.untracked.uint32(92),
+        engineName = cms.untracked.string('Philox4x32')
+    ),
+    enableChecking = cms.untracked.bool(True),
+    verbose = cms.untracked.bool(False)
+)
+
+process.maxEvents = cms.untracked.PSet(
+    input = cms.untracked.int32(5)
+)
+
+process.source = cms.Source("EmptySource",
+    firstRun = cms.untracked.uint32(1),
+    firstLuminosityBlock = cms.untracked.uint32(1),
+    firstEvent = cms.untracked.uint32(1),
+    numberEventsInRun = cms.untracked.uint32(100),
+    numberEventsInLuminosityBlock = cms.untracked.uint32(3)
+)
+
+process.t1 = cms.EDAnalyzer("TestRandomNumberServiceGlobal",
+                            engineName = cms.untracked.string('Philox4x32'),
+                            seeds = cms.untracked.vuint32(91),
+                            offset = cms.untracked.uint32(0),
+                            maxEvents = cms.untracked.uint32(5),
+                            nStreams = cms.untracked.uint32(3)
+)
+process.t2 = cms.EDAnalyzer("TestRandomNumberServiceGlobal",
+                            engineName = cms.untracked.string('Philox4x32'),
+                            seeds = cms.untracked.vuint32(92),
+                            offset = cms.untracked.uint32(0),
+                            maxEvents = cms.untracked.uint32(5),
+                            nStreams = cms.untracked.uint32(3)
+)
+
+process.randomEngineStateProducer = cms.EDProducer("RandomEngineStateProducer")
+
+process.out = cms.OutputModule("PoolOutputModule",
+    fileName = cms.untracked.string('testPhiloxMultiStream.root')
+)
+
+process.p = cms.Path(process.t1+process.t2+process.randomEngineStateProducer)
+process.o = cms.EndPath(process.out)
@@ -134,6 +134,49 @@ pushd ${LOCAL_TMP_DIR}
 
   diff lastEvent.sorted replayLastEvent.sorted || die "comparing files containing random numbers of last event in a stream" $?
 
+  echo " "
+  echo "RandomNumberGeneratorService Philox4x32 multistream test"
+  echo "=============================================="
+
+  rm -rf testRandomServiceL1E1.txt
+  rm -rf testRandomServiceL1E2.txt
+  rm -rf testRandomServiceL1E3.txt
+  rm -rf testRandomServiceL2E4.txt
+  rm -rf testRandomServiceL2E5.txt
+
+  rm -rf stream0LastEvent.txt
+  rm -rf stream1LastEvent.txt
+  rm -rf stream2LastEvent.txt
+
+  cmsRun ${LOCAL_TEST_DIR}/testPhiloxMultiStream_cfg.py || die "cmsRun testPhiloxMultiStream_cfg.py" $?
+
+  echo " "
+  echo "RandomNumberGeneratorService Philox4x32 multistream test replay from event"
+  echo "=============================================="
+
+  rm -rf replaytestRandomServiceL1E3.txt
+  rm -rf replaytestRandomServiceL2E4.txt
+  rm -rf replaytestRandomServiceL2E5.txt
+
+  rm -rf replaystream0LastEvent.txt
+  rm -rf replaystream1LastEvent.txt
+  rm -rf replaystream2LastEvent.txt
+
+  cmsRun ${LOCAL_TEST_DIR}/testPhiloxMultiStreamReplay_cfg.py || die "cmsRun testPhiloxMultiStreamReplay_cfg.py" $?
+
+  # sort so this does not depend on module execution order
+  sort testRandomServiceL1E3.txt > testRandomServiceL1E3.sorted
+  sort testRandomServiceL2E4.txt > testRandomServiceL2E4.sorted
+  sort testRandomServiceL2E5.txt > testRandomServiceL2E5.sorted
+
+  sort replaytestRandomServiceL1E3.txt > replaytestRandomServiceL1E3.sorted
+  sort replaytestRandomServiceL2E4.txt > replaytestRandomServiceL2E4.sorted
+  sort replaytestRandomServiceL2E5.txt > replaytestRandomServiceL2E5.sorted
+
+  diff testRandomServiceL1E3.sorted replaytestRandomServiceL1E3.sorted || die "comparing Philox testRandomServiceL1E3.sorted and replaytestRandomServiceL1E3.sorted" $?
+  diff testRandomServiceL2E4.sorted replaytestRandomServiceL2E4.sorted || die "comparing Philox testRandomServiceL2E4.sorted and replaytestRandomServiceL2E4.sorted" $?
+  diff testRandomServiceL2E5.sorted replaytestRandomServiceL2E5.sorted || die "comparing Philox testRandomServiceL2E5.sorted and replaytestRandomServiceL2E5.sorted" $?
+
 popd
 
 exit 0
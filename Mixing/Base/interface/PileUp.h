@@ -170,6 +170,11 @@ namespace edm {
    *
    *  The "signal" event is optionally used to restrict 
    *  the secondary events used for pileup and mixing.
+   *
+   *  Each pileup event is read anew for every bunch crossing it is used
+   *  in: the mixing adjusters apply the bunch crossing and event offsets
+   *  in place to the products held by the EventPrincipal, so a principal
+   *  cannot be kept in a pool and replayed for another crossing.
    */
   template<typename T>
   void
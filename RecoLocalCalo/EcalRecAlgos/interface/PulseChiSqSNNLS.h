@@ -38,6 +38,7 @@ class PulseChiSqSNNLS {
     void NNLSConstrainParameter(Index minratioidx);
     bool OnePulseMinimize();
     bool updateCov(const SampleMatrix &samplecov, const FullSampleMatrix &fullpulsecov);
+    bool HasPulseAmplitude() const;
     double ComputeChiSq();
     double ComputeApproxUncertainty(unsigned int ipulse);
     
@@ -67,6 +68,7 @@ class PulseChiSqSNNLS {
     PulseVector ampvecpermtest;
     
     double _chisq;
+    bool _covhaspulses; //pulse covariance was added in the last updateCov
     bool _computeErrors;
     int _maxiters;
     bool _maxiterwarnings;
@@ -74,6 +74,7 @@ void eigen_solve_submatrix(PulseMatrix& mat, PulseVector& invec, PulseVector& ou
 
 PulseChiSqSNNLS::PulseChiSqSNNLS() :
   _chisq(0.),
+  _covhaspulses(false),
   _computeErrors(true),
   _maxiters(50),
   _maxiterwarnings(true)
@@ -265,6 +266,12 @@ bool PulseChiSqSNNLS::Minimize(const SampleMatrix &samplecov, const FullSampleMa
     if (std::abs(deltachisq)<1e-3) {
       break;
     }
+    //no pulse contributed to the covariance used for this iteration and none
+    //would contribute to the next one: the next iteration would repeat this
+    //one exactly (typically channels with noise only), so stop here
+    if (!_covhaspulses && !HasPulseAmplitude()) {
+      break;
+    }
     ++iter;    
   }  
   
@@ -278,11 +285,13 @@ bool PulseChiSqSNNLS::updateCov(const SampleMatrix &samplecov, const FullSampleM
   const unsigned int npulse = _bxs.rows();
 
   _invcov = samplecov; //
+  _covhaspulses = false;
   
   for (unsigned int ipulse=0; ipulse<npulse; ++ipulse) {
     if (_ampvec.coeff(ipulse)==0.) continue;
     int bx = _bxs.coeff(ipulse);
     if (std::abs(bx)>=100) continue; //no contribution to covariance from pedestal or saturation/slew step correction
+    _covhaspulses = true;
     
     int firstsamplet = std::max(0,bx + 3);
     int offset = 7-3-bx;
@@ -302,6 +311,17 @@ bool PulseChiSqSNNLS::updateCov(const SampleMatrix &samplecov, const FullSampleM
     
 }
 
+bool PulseChiSqSNNLS::HasPulseAmplitude() const {
+  
+  //true if any pulse (not pedestal or step correction) would contribute to the covariance
+  const unsigned int npulse = _bxs.rows();
+  for (unsigned int ipulse=0; ipulse<npulse; ++ipulse) {
+    if (_ampvec.coeff(ipulse)!=0. && std::abs(_bxs.coeff(ipulse))<100) return true;
+  }
+  return false;
+  
+}
+
 double PulseChiSqSNNLS::ComputeChiSq() {
   
 //   SampleVector resvec = _pulsemat*_ampvec - _sampvec;
@@ -21,6 +21,8 @@
 #include <vector>
 #include <set>
 #include <numeric>
+#include <array>
+#include <algorithm>
 
 #include "KDTreeLinkerAlgoT.h"
 
@@ -52,6 +54,7 @@ enum VerbosityLevel { pDEBUG = 0, pWARNING = 1, pINFO = 2, pERROR = 3 };
 HGCalImagingAlgo() : vecDeltas(), kappa(1.), ecut(0.),
         sigma2(1.0),
         algoId(reco::CaloCluster::undefined),
+        useTiles(false),
         verbosity(pERROR),initialized(false){
 }
 
@@ -64,6 +67,7 @@ HGCalImagingAlgo(const std::vector<double>& vecDeltas_in, double kappa_in, doubl
                  double fcPerEle_in,
                  const std::vector<double>& nonAgedNoises_in,
                  double noiseMip_in,
+                 bool useTiles_in,
                  VerbosityLevel the_verbosity = pERROR) :
         vecDeltas(vecDeltas_in), kappa(kappa_in),
         ecut(ecut_in),
@@ -76,13 +80,15 @@ HGCalImagingAlgo(const std::vector<double>& vecDeltas_in, double kappa_in, doubl
         fcPerEle(fcPerEle_in),
         nonAgedNoises(nonAgedNoises_in),
         noiseMip(noiseMip_in),
+        useTiles(useTiles_in),
         verbosity(the_verbosity),
         initialized(false),
         points(2*(maxlayer+1)),
         minpos(2*(maxlayer+1),{
                 {0.0f,0.0f}
         }),
-        maxpos(2*(maxlayer+1),{ {0.0f,0.0f} })
+        maxpos(2*(maxlayer+1),{ {0.0f,0.0f} }),
+        tiles(useTiles_in ? 2*(maxlayer+1) : 0)
 {
 }
 
@@ -96,6 +102,7 @@ HGCalImagingAlgo(const std::vector<double>& vecDeltas_in, double kappa_in, doubl
                  double fcPerEle_in,
                  const std::vector<double>& nonAgedNoises_in,
                  double noiseMip_in,
+                 bool useTiles_in,
                  VerbosityLevel the_verbosity = pERROR) : vecDeltas(vecDeltas_in), kappa(kappa_in),
         ecut(ecut_in),
         sigma2(std::pow(showerSigma,2.0)),
@@ -107,13 +114,15 @@ HGCalImagingAlgo(const std::vector<double>& vecDeltas_in, double kappa_in, doubl
         fcPerEle(fcPerEle_in),
         nonAgedNoises(nonAgedNoises_in),
         noiseMip(noiseMip_in),
+        useTiles(useTiles_in),
         verbosity(the_verbosity),
         initialized(false),
         points(2*(maxlayer+1)),
 	minpos(2*(maxlayer+1),{
                 {0.0f,0.0f}
         }),
-	maxpos(2*(maxlayer+1),{ {0.0f,0.0f} })
+	maxpos(2*(maxlayer+1),{ {0.0f,0.0f} }),
+        tiles(useTiles_in ? 2*(maxlayer+1) : 0)
 {
 }
 
@@ -196,6 +205,9 @@ double noiseMip;
 std::vector<std::vector<double> > thresholds;
 std::vector<std::vector<double> > v_sigmaNoise;
 
+// replace the per-layer KD-tree by a fixed grid of tiles with side >= delta_c
+bool useTiles;
+
 // The verbosity level
 VerbosityLevel verbosity;
 
@@ -272,6 +284,29 @@ std::vector<std::vector<KDNode> > points;   //a vector of vectors of hexels, one
 std::vector<std::array<float,2> > minpos;
 std::vector<std::array<float,2> > maxpos;
 
+// hits of one layer binned in square tiles of side >= delta_c, so that all
+// the neighbours within delta_c of a hit are in the 3x3 tiles around it;
+// coordinates and weights are copied in tile order (SoA) for the searches
+struct LayerTiles {
+        static const int maxTilesPerDim = 512;
+
+        double minX, minY, tileSize;
+        int nX, nY;
+        std::vector<unsigned int> offsets;   // nX*nY+1 entries (CSR)
+        std::vector<unsigned int> index;     // hit index in the layer, in tile order
+        std::vector<double> x;
+        std::vector<double> y;
+        std::vector<double> weight;
+
+        void fill(const std::vector<KDNode> &, const std::array<float,2> &, const std::array<float,2> &, double);
+        int tileX(double xx) const { return std::min(nX-1, std::max(0, int((xx-minX)/tileSize))); }
+        int tileY(double yy) const { return std::min(nY-1, std::max(0, int((yy-minY)/tileSize))); }
+        unsigned int begin(int ix, int iy) const { return offsets[iy*nX+ix]; }
+        unsigned int end(int ix, int iy) const { return offsets[iy*nX+ix+1]; }
+};
+
+std::vector<LayerTiles> tiles;   // one per layer, only used if useTiles
+
 
 //these functions should be in a helper class.
 inline double distance2(const Hexel &pt1, const Hexel &pt2) const{   //distance squared
@@ -284,7 +319,13 @@ inline double distance(const Hexel &pt1, const Hexel &pt2) const{   //2-d distan
 }
 double calculateLocalDensity(std::vector<KDNode> &, KDTree &, const unsigned int) const;   //return max density
 double calculateDistanceToHigher(std::vector<KDNode> &) const;
-int findAndAssignClusters(std::vector<KDNode> &, KDTree &, double, KDTreeBox &, const unsigned int, std::vector<std::vector<KDNode> >&) const;
+int findAndAssignClusters(std::vector<KDNode> &, KDTree &, double, KDTreeBox &, const unsigned int, std::vector<std::vector<KDNode> >&, const LayerTiles * = nullptr) const;
+// tiled versions of the density and nearest-higher searches (same results)
+double calculateLocalDensity(std::vector<KDNode> &, const LayerTiles &, const unsigned int) const;
+double calculateDistanceToHigher(std::vector<KDNode> &, const LayerTiles &) const;
+float criticalDistance(const unsigned int layer) const {
+        return layer <= lastLayerEE ? vecDeltas[0] : (layer <= lastLayerFH ? vecDeltas[1] : vecDeltas[2]);
+}
 math::XYZPoint calculatePosition(std::vector<KDNode> &) const;
 
 // attempt to find subclusters within a given set of hexels
@@ -12,6 +12,8 @@
 #include "tbb/task_arena.h"
 #include "tbb/tbb.h"
 
+#include <limits>
+
 void HGCalImagingAlgo::populate(const HGCRecHitCollection &hits) {
   // loop over all hits and create the Hexel structure, skip energies below ecut
 
@@ -90,13 +92,28 @@ void HGCalImagingAlgo::makeClusters() {
     tbb::parallel_for(size_t(0), size_t(2 * maxlayer + 2), [&](size_t i) {
       KDTreeBox bounds(minpos[i][0], maxpos[i][0], minpos[i][1], maxpos[i][1]);
       KDTree hit_kdtree;
-      hit_kdtree.build(points[i], bounds);
 
       unsigned int actualLayer =
           i > maxlayer
               ? (i - (maxlayer + 1))
               : i; // maps back from index used for KD trees to actual layer
 
+      if (useTiles) {
+        // same passes, with the neighbour searches done on the tiles of
+        // this layer and parallelised over its hits
+        tiles[i].fill(points[i], minpos[i], maxpos[i],
+                      criticalDistance(actualLayer));
+        double maxdensity =
+            calculateLocalDensity(points[i], tiles[i], actualLayer);
+        calculateDistanceToHigher(points[i], tiles[i]);
+        findAndAssignClusters(points[i], hit_kdtree, maxdensity, bounds,
+                              actualLayer, layerClustersPerLayer[i],
+                              &tiles[i]);
+        return;
+      }
+
+      hit_kdtree.build(points[i], bounds);
+
       double maxdensity = calculateLocalDensity(
           points[i], hit_kdtree, actualLayer); // also stores rho (energy
                                                // density) for each point (node)
@@ -109,6 +126,45 @@ void HGCalImagingAlgo::makeClusters() {
   });
 }
 
+void HGCalImagingAlgo::LayerTiles::fill(const std::vector<KDNode> &nd,
+                                        const std::array<float, 2> &minp,
+                                        const std::array<float, 2> &maxp,
+                                        double delta_c) {
+  // tiles must be at least delta_c wide; widen them for very sparse or very
+  // extended layers to keep the grid bounded
+  minX = minp[0];
+  minY = minp[1];
+  const double extent = std::max(maxp[0] - minp[0], maxp[1] - minp[1]);
+  tileSize = std::max(delta_c, extent / maxTilesPerDim);
+  if (tileSize <= 0.)
+    tileSize = 1.;
+  nX = int((maxp[0] - minp[0]) / tileSize) + 1;
+  nY = int((maxp[1] - minp[1]) / tileSize) + 1;
+
+  const unsigned int nd_size = nd.size();
+  offsets.assign(nX * nY + 1, 0);
+  index.resize(nd_size);
+  x.resize(nd_size);
+  y.resize(nd_size);
+  weight.resize(nd_size);
+
+  // counting sort of the hits by tile, keeping their order within a tile
+  std::vector<unsigned int> tileOfHit(nd_size);
+  for (unsigned int i = 0; i < nd_size; ++i) {
+    tileOfHit[i] = tileY(nd[i].data.y) * nX + tileX(nd[i].data.x);
+    ++offsets[tileOfHit[i] + 1];
+  }
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  std::vector<unsigned int> next(offsets.begin(), offsets.end() - 1);
+  for (unsigned int i = 0; i < nd_size; ++i) {
+    const unsigned int k = next[tileOfHit[i]]++;
+    index[k] = i;
+    x[k] = nd[i].data.x;
+    y[k] = nd[i].data.y;
+    weight[k] = nd[i].data.weight;
+  }
+}
+
 std::vector<reco::BasicCluster> HGCalImagingAlgo::getClusters(bool doSharing) {
 
   reco::CaloID caloID = reco::CaloID::DET_HGCAL_ENDCAP;
@@ -314,10 +370,147 @@ HGCalImagingAlgo::calculateDistanceToHigher(std::vector<KDNode> &nd) const {
   }
   return maxdensity;
 }
+double HGCalImagingAlgo::calculateLocalDensity(std::vector<KDNode> &nd,
+                                               const LayerTiles &lt,
+                                               const unsigned int layer) const {
+
+  const float delta_c = criticalDistance(layer);
+
+  // the tiles are at least delta_c wide, so the 3x3 tiles around a hit
+  // contain all its neighbours; each hit only updates its own rho
+  tbb::parallel_for(
+      tbb::blocked_range<unsigned int>(0, nd.size(), 256),
+      [&](const tbb::blocked_range<unsigned int> &r) {
+        for (unsigned int i = r.begin(); i != r.end(); ++i) {
+          const double xi = nd[i].data.x;
+          const double yi = nd[i].data.y;
+          const int ix = lt.tileX(xi);
+          const int iy = lt.tileY(yi);
+          double rho = 0.;
+          for (int ty = std::max(0, iy - 1); ty <= std::min(lt.nY - 1, iy + 1);
+               ++ty) {
+            for (int tx = std::max(0, ix - 1);
+                 tx <= std::min(lt.nX - 1, ix + 1); ++tx) {
+              for (unsigned int k = lt.begin(tx, ty), e = lt.end(tx, ty);
+                   k != e; ++k) {
+                const double dx = xi - lt.x[k];
+                const double dy = yi - lt.y[k];
+                if (std::sqrt(dx * dx + dy * dy) < delta_c)
+                  rho += lt.weight[k];
+              }
+            }
+          }
+          nd[i].data.rho += rho;
+        }
+      });
+
+  double maxdensity = 0.;
+  for (auto &n : nd)
+    maxdensity = std::max(maxdensity, n.data.rho);
+  return maxdensity;
+}
+
+double
+HGCalImagingAlgo::calculateDistanceToHigher(std::vector<KDNode> &nd,
+                                            const LayerTiles &lt) const {
+
+  // sort vector of Hexels by decreasing local density
+  std::vector<size_t> rs = sorted_indices(nd);
+
+  if (rs.empty())
+    return 0.; // there are no hits
+  const double maxdensity = nd[rs[0]].data.rho;
+
+  // same convention as the KD-tree version for the highest density hit
+  double dist2 = 0.;
+  for (auto &j : nd)
+    dist2 = std::max(dist2, distance2(nd[rs[0]].data, j.data));
+  nd[rs[0]].data.delta = std::sqrt(dist2);
+  nd[rs[0]].data.nearestHigher = -1;
+
+  const unsigned int nd_size = nd.size();
+  std::vector<unsigned int> rank(nd_size);
+  for (unsigned int oi = 0; oi < nd_size; ++oi)
+    rank[rs[oi]] = oi;
+
+  // for each hit, search the rings of tiles around it for the closest hit of
+  // higher rank; a ring is enough once the best distance is smaller than the
+  // distance to any tile outside it. Ties are resolved towards the higher
+  // rank, as the "<=" of the exhaustive search does. When the search area
+  // grows beyond the number of candidates the exhaustive search is used.
+  tbb::parallel_for(
+      tbb::blocked_range<unsigned int>(1, nd_size, 256),
+      [&](const tbb::blocked_range<unsigned int> &r) {
+        for (unsigned int oi = r.begin(); oi != r.end(); ++oi) {
+          const unsigned int i = rs[oi];
+          const double xi = nd[i].data.x;
+          const double yi = nd[i].data.y;
+          const int ix = lt.tileX(xi);
+          const int iy = lt.tileY(yi);
+          const int maxRing = std::max(std::max(ix, lt.nX - 1 - ix),
+                                       std::max(iy, lt.nY - 1 - iy));
+
+          double best2 = std::numeric_limits<double>::max();
+          int nearestHigher = -1;
+          bool done = false;
+          for (int ring = 0; ring <= maxRing; ++ring) {
+            if (unsigned((2 * ring + 1) * (2 * ring + 1)) > oi)
+              break;
+            for (int ty = iy - ring; ty <= iy + ring; ++ty) {
+              if (ty < 0 || ty >= lt.nY)
+                continue;
+              const bool fullRow = (ty == iy - ring || ty == iy + ring);
+              for (int tx = ix - ring; tx <= ix + ring;
+                   tx += (fullRow || ring == 0) ? 1 : 2 * ring) {
+                if (tx < 0 || tx >= lt.nX)
+                  continue;
+                for (unsigned int k = lt.begin(tx, ty), e = lt.end(tx, ty);
+                     k != e; ++k) {
+                  const unsigned int j = lt.index[k];
+                  if (rank[j] >= oi)
+                    continue;
+                  const double dx = xi - lt.x[k];
+                  const double dy = yi - lt.y[k];
+                  const double tmp = dx * dx + dy * dy;
+                  if (tmp < best2 ||
+                      (tmp == best2 && rank[j] > rank[nearestHigher])) {
+                    best2 = tmp;
+                    nearestHigher = j;
+                  }
+                }
+              }
+            }
+            // every hit outside the current rings is further than
+            // ring*tileSize (minus a margin for the binning rounding)
+            const double reach = (ring - 1e-3) * lt.tileSize;
+            if (ring == maxRing || (reach > 0. && best2 < reach * reach)) {
+              done = nearestHigher != -1;
+              break;
+            }
+          }
+          if (!done) {
+            best2 = std::numeric_limits<double>::max();
+            for (unsigned int oj = 0; oj < oi; ++oj) {
+              const unsigned int j = rs[oj];
+              const double tmp = distance2(nd[i].data, nd[j].data);
+              if (tmp <= best2) {
+                best2 = tmp;
+                nearestHigher = j;
+              }
+            }
+          }
+          nd[i].data.delta = std::sqrt(best2);
+          nd[i].data.nearestHigher = nearestHigher;
+        }
+      });
+  return maxdensity;
+}
+
 int HGCalImagingAlgo::findAndAssignClusters(
     std::vector<KDNode> &nd, KDTree &lp, double maxdensity, KDTreeBox &bounds,
     const unsigned int layer,
-    std::vector<std::vector<KDNode>> &clustersOnLayer) const {
+    std::vector<std::vector<KDNode>> &clustersOnLayer,
+    const LayerTiles *lt) const {
 
   // this is called once per layer and endcap...
   // so when filling the cluster temporary vector of Hexels we resize each time
@@ -389,51 +582,95 @@ int HGCalImagingAlgo::findAndAssignClusters(
   // assign points closer than dc to other clusters to border region
   // and find critical border density
   std::vector<double> rho_b(nClustersOnLayer, 0.);
-  lp.clear();
-  lp.build(nd, bounds);
-  // now loop on all hits again :( and check: if there are hits from another
-  // cluster within d_c -> flag as border hit
-  for (unsigned int i = 0; i < nd_size; ++i) {
-    int ci = nd[i].data.clusterIndex;
-    bool flag_isolated = true;
-    if (ci != -1) {
-      KDTreeBox search_box(nd[i].dims[0] - delta_c, nd[i].dims[0] + delta_c,
-                           nd[i].dims[1] - delta_c, nd[i].dims[1] + delta_c);
-      std::vector<KDNode> found;
-      lp.search(search_box, found);
-
-      const unsigned int found_size = found.size();
-      for (unsigned int j = 0; j < found_size;
-           j++) { // start from 0 here instead of 1
-        // check if the hit is not within d_c of another cluster
-        if (found[j].data.clusterIndex != -1) {
-          float dist = distance(found[j].data, nd[i].data);
-          if (dist < delta_c && found[j].data.clusterIndex != ci) {
-            // in which case we assign it to the border
-            nd[i].data.isBorder = true;
-            break;
+  if (lt != nullptr) {
+    // same border/halo logic as below, with the neighbours taken from the
+    // tiles: flag the border hits in parallel, then find rho_b per cluster
+    tbb::parallel_for(
+        tbb::blocked_range<unsigned int>(0, nd_size, 256),
+        [&](const tbb::blocked_range<unsigned int> &r) {
+          for (unsigned int i = r.begin(); i != r.end(); ++i) {
+            int ci = nd[i].data.clusterIndex;
+            if (ci == -1)
+              continue;
+            const int ix = lt->tileX(nd[i].data.x);
+            const int iy = lt->tileY(nd[i].data.y);
+            bool flag_isolated = true;
+            bool isBorder = false;
+            for (int ty = std::max(0, iy - 1);
+                 !isBorder && ty <= std::min(lt->nY - 1, iy + 1); ++ty) {
+              for (int tx = std::max(0, ix - 1);
+                   !isBorder && tx <= std::min(lt->nX - 1, ix + 1); ++tx) {
+                for (unsigned int k = lt->begin(tx, ty), e = lt->end(tx, ty);
+                     k != e; ++k) {
+                  const Hexel &other = nd[lt->index[k]].data;
+                  if (other.clusterIndex == -1)
+                    continue;
+                  float dist = distance(other, nd[i].data);
+                  if (dist < delta_c && other.clusterIndex != ci) {
+                    isBorder = true;
+                    break;
+                  }
+                  if (dist < delta_c && dist != 0. && other.clusterIndex == ci)
+                    flag_isolated = false;
+                }
+              }
+            }
+            if (isBorder || flag_isolated)
+              nd[i].data.isBorder = true;
           }
-          // because we are using two different containers, we have to make sure
-          // that we don't unflag the
-          // hit when it finds *itself* closer than delta_c
-          if (dist < delta_c && dist != 0. &&
-              found[j].data.clusterIndex == ci) {
-            // in this case it is not an isolated hit
-            // the dist!=0 is because the hit being looked at is also inside the
-            // search box and at dist==0
-            flag_isolated = false;
+        });
+    for (unsigned int i = 0; i < nd_size; ++i) {
+      int ci = nd[i].data.clusterIndex;
+      if (ci != -1 && nd[i].data.isBorder && rho_b[ci] < nd[i].data.rho)
+        rho_b[ci] = nd[i].data.rho;
+    }
+  } else {
+    lp.clear();
+    lp.build(nd, bounds);
+    // now loop on all hits again :( and check: if there are hits from another
+    // cluster within d_c -> flag as border hit
+    for (unsigned int i = 0; i < nd_size; ++i) {
+      int ci = nd[i].data.clusterIndex;
+      bool flag_isolated = true;
+      if (ci != -1) {
+        KDTreeBox search_box(nd[i].dims[0] - delta_c, nd[i].dims[0] + delta_c,
+                             nd[i].dims[1] - delta_c, nd[i].dims[1] + delta_c);
+        std::vector<KDNode> found;
+        lp.search(search_box, found);
+
+        const unsigned int found_size = found.size();
+        for (unsigned int j = 0; j < found_size;
+             j++) { // start from 0 here instead of 1
+          // check if the hit is not within d_c of another cluster
+          if (found[j].data.clusterIndex != -1) {
+            float dist = distance(found[j].data, nd[i].data);
+            if (dist < delta_c && found[j].data.clusterIndex != ci) {
+              // in which case we assign it to the border
+              nd[i].data.isBorder = true;
+              break;
+            }
+            // because we are using two different containers, we have to make sure
+            // that we don't unflag the
+            // hit when it finds *itself* closer than delta_c
+            if (dist < delta_c && dist != 0. &&
+                found[j].data.clusterIndex == ci) {
+              // in this case it is not an isolated hit
+              // the dist!=0 is because the hit being looked at is also inside the
+              // search box and at dist==0
+              flag_isolated = false;
+            }
           }
         }
+        if (flag_isolated)
+          nd[i].data.isBorder =
+              true; // the hit is more than delta_c from any of its brethren
       }
-      if (flag_isolated)
-        nd[i].data.isBorder =
-            true; // the hit is more than delta_c from any of its brethren
-    }
-    // check if this border hit has density larger than the current rho_b and
-    // update
-    if (nd[i].data.isBorder && rho_b[ci] < nd[i].data.rho)
-      rho_b[ci] = nd[i].data.rho;
-  } // end loop all hits
+      // check if this border hit has density larger than the current rho_b and
+      // update
+      if (nd[i].data.isBorder && rho_b[ci] < nd[i].data.rho)
+        rho_b[ci] = nd[i].data.rho;
+    } // end loop all hits
+  }
 
   // flag points in cluster with density < rho_b as halo points, then fill the
   // cluster vector
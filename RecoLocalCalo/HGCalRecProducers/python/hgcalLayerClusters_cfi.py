@@ -15,6 +15,9 @@ hgcalLayerClusters =  cms.EDProducer(
     doSharing = cms.bool(False),
     deltac = cms.vdouble(2.,2.,5.),
     dependSensor = cms.bool(True),
+    # bin the hits of each layer in tiles instead of a KD-tree for the
+    # density and nearest-higher searches, parallelised over the hits
+    useTiles = cms.bool(False),
     ecut = cms.double(3.),
     kappa = cms.double(9.),
     multiclusterRadii = cms.vdouble(2.,5.,5.),
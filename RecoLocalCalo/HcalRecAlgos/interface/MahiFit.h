@@ -81,6 +81,46 @@ struct MahiNnlsWorkspace {
 
 };
 
+//pulse shapes evaluated by the PulseShapeFunctor at a given arrival time:
+//the in-time pulse is evaluated twice per channel (pre-fit and full fit)
+//and all the pulses below the time-slew charge threshold share the same
+//arrival time, so recent evaluations are kept and reused
+struct MahiPulseShapeCache {
+
+  static constexpr unsigned int size = 8;
+
+  struct Entry {
+    float t0 = 0;
+    double dt = 0;
+    bool valid = false;
+    std::array<double, MaxSVSize> pulseN;
+    std::array<double, MaxSVSize> pulseM;
+    std::array<double, MaxSVSize> pulseP;
+  };
+
+  const Entry* find(float t0, double dt) const {
+    for (auto const& entry : entries) {
+      if (entry.valid && entry.t0==t0 && entry.dt==dt) return &entry;
+    }
+    return nullptr;
+  }
+
+  Entry& next() {
+    Entry& entry = entries[last];
+    last = (last+1)%size;
+    return entry;
+  }
+
+  void clear() {
+    for (auto& entry : entries) entry.valid = false;
+    last = 0;
+  }
+
+  std::array<Entry, size> entries;
+  unsigned int last = 0;
+
+};
+
 struct MahiDebugInfo {
 
   int   nSamples;
@@ -167,6 +207,7 @@ class MahiFit
   void solveSubmatrix(PulseMatrix& mat, PulseVector& invec, PulseVector& outvec, unsigned nP) const;
 
   mutable MahiNnlsWorkspace nnlsWork_;
+  mutable MahiPulseShapeCache pulseShapeCache_;
 
   //hard coded in initializer
   const unsigned int fullTSSize_;
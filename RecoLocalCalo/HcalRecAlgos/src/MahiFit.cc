@@ -261,22 +261,36 @@ void MahiFit::updatePulseShape(double itQ, FullSampleVector &pulseShape, FullSam
     else t0+=hcalTimeSlewDelay_->delay(itQ,slewFlavor_);
   }
 
-  nnlsWork_.pulseN.fill(0);
-  nnlsWork_.pulseM.fill(0);
-  nnlsWork_.pulseP.fill(0);
+  const MahiPulseShapeCache::Entry* cached = pulseShapeCache_.find(t0, nnlsWork_.dt);
+  if (cached==nullptr) {
+    MahiPulseShapeCache::Entry& entry = pulseShapeCache_.next();
 
-  const double xx[4]={t0, 1.0, 0.0, 3};
-  const double xxm[4]={-nnlsWork_.dt+t0, 1.0, 0.0, 3};
-  const double xxp[4]={ nnlsWork_.dt+t0, 1.0, 0.0, 3};
+    entry.pulseN.fill(0);
+    entry.pulseM.fill(0);
+    entry.pulseP.fill(0);
 
-  (*pfunctor_)(&xx[0]);
-  psfPtr_->getPulseShape(nnlsWork_.pulseN);
+    const double xx[4]={t0, 1.0, 0.0, 3};
+    const double xxm[4]={-nnlsWork_.dt+t0, 1.0, 0.0, 3};
+    const double xxp[4]={ nnlsWork_.dt+t0, 1.0, 0.0, 3};
 
-  (*pfunctor_)(&xxm[0]);
-  psfPtr_->getPulseShape(nnlsWork_.pulseM);
-  
-  (*pfunctor_)(&xxp[0]);
-  psfPtr_->getPulseShape(nnlsWork_.pulseP);
+    (*pfunctor_)(&xx[0]);
+    psfPtr_->getPulseShape(entry.pulseN);
+
+    (*pfunctor_)(&xxm[0]);
+    psfPtr_->getPulseShape(entry.pulseM);
+
+    (*pfunctor_)(&xxp[0]);
+    psfPtr_->getPulseShape(entry.pulseP);
+
+    entry.t0 = t0;
+    entry.dt = nnlsWork_.dt;
+    entry.valid = true;
+    cached = &entry;
+  }
+
+  nnlsWork_.pulseN = cached->pulseN;
+  nnlsWork_.pulseM = cached->pulseM;
+  nnlsWork_.pulseP = cached->pulseP;
 
   //in the 2018+ case where the sample of interest (SOI) is in TS3, add an extra offset to align 
   //with previous SOI=TS4 case assumed by psfPtr_->getPulseShape()
@@ -490,6 +504,7 @@ void MahiFit::resetPulseShapeTemplate(const HcalPulseShapes::Shape& ps) {
 
   // only the pulse shape itself from PulseShapeFunctor is used for Mahi
   // the uncertainty terms calculated inside PulseShapeFunctor are used for Method 2 only
+  pulseShapeCache_.clear();
   psfPtr_.reset(new FitterFuncs::PulseShapeFunctor(ps,false,false,false,
 						   1,0,0,10));
   pfunctor_ = std::unique_ptr<ROOT::Math::Functor>( new ROOT::Math::Functor(psfPtr_.get(),&FitterFuncs::PulseShapeFunctor::singlePulseShapeFunc, 3) );
@@ -3,6 +3,7 @@
 
 
 #include "RecoParticleFlow/PFClusterProducer/interface/PFRecHitNavigatorBase.h"
+#include "FWCore/Framework/interface/ESWatcher.h"
 #include "Geometry/CaloGeometry/interface/CaloSubdetectorGeometry.h"
 #include "Geometry/CaloGeometry/interface/CaloGeometry.h"
 
@@ -47,6 +48,8 @@ class PFECALHashNavigator : public PFRecHitNavigatorBase {
   }
 
   void beginEvent(const edm::EventSetup& iSetup) override {
+      // the neighbour arrays only depend on the geometry
+      if( !geomWatcher_.check(iSetup) ) return;
       edm::ESHandle<CaloGeometry> geoHandle;
       iSetup.get<CaloGeometryRecord>().get(geoHandle);
       
@@ -59,8 +62,8 @@ class PFECALHashNavigator : public PFRecHitNavigatorBase {
       endcapGeometry_  = dynamic_cast < const EcalEndcapGeometry* > (eeTmp);
 
       // get the ecalBarrel topology
-      barrelTopology_ = new  EcalBarrelTopology(geoHandle);
-      endcapTopology_ = new  EcalEndcapTopology(geoHandle);
+      barrelTopology_.reset( new  EcalBarrelTopology(geoHandle) );
+      endcapTopology_.reset( new  EcalEndcapTopology(geoHandle) );
 
       ecalNeighbArray(*barrelGeometry_,*barrelTopology_,*endcapGeometry_,*endcapTopology_);
 
@@ -83,6 +86,7 @@ class PFECALHashNavigator : public PFRecHitNavigatorBase {
   DetId west  = move( center, WEST );  
 
 
+  rh.reserveNeighbours(8);
   associateNeighbour(north,rh,hits,refprod,0,1,0);
   associateNeighbour(northeast,rh,hits,refprod,1,1,0);
   associateNeighbour(south,rh,hits,refprod,0,-1,0);
@@ -113,6 +117,7 @@ class PFECALHashNavigator : public PFRecHitNavigatorBase {
 
     const unsigned nbarrel = 62000;
     // Barrel first. The hashed index runs from 0 to 61199
+    neighboursEB_.clear();
     neighboursEB_.resize(nbarrel);
   
     //std::cout << " Building the array of neighbours (barrel) " ;
@@ -180,6 +185,7 @@ class PFECALHashNavigator : public PFRecHitNavigatorBase {
     // of crystals
     const unsigned nendcap=19960;
 
+    neighboursEE_.clear();
     neighboursEE_.resize(nendcap);
     for(unsigned ic=0; ic<size; ++ic) 
       {
@@ -418,8 +424,10 @@ DetId move(DetId cell,
 }
 
 
-  EcalEndcapTopology *endcapTopology_;
-  EcalBarrelTopology *barrelTopology_;
+  std::unique_ptr<EcalEndcapTopology> endcapTopology_;
+  std::unique_ptr<EcalBarrelTopology> barrelTopology_;
+
+  edm::ESWatcher<CaloGeometryRecord> geomWatcher_;
 
   const EcalEndcapGeometry *endcapGeometry_;
   const EcalBarrelGeometry *barrelGeometry_;
@@ -37,74 +37,12 @@ class PFRecHitCaloNavigatorWithTime : public PFRecHitNavigatorBase {
 
 
   void associateNeighbours(reco::PFRecHit& hit,std::unique_ptr<reco::PFRecHitCollection>& hits,edm::RefProd<reco::PFRecHitCollection>& refProd) override {
-      DetId detid( hit.detId() );
-      
-      CaloNavigator<D> navigator(detid, topology_.get());
-      
-      DetId N(0);
-      DetId E(0);
-      DetId S(0);
-      DetId W(0);
-      DetId NW(0);
-      DetId NE(0);
-      DetId SW(0);
-      DetId SE(0);
-
-
-      N=navigator.north();  
-      associateNeighbour(N,hit,hits,refProd,0,1);
-
-
-      if (N !=DetId(0)) {
-	NE=navigator.east();
+      const NeighbourIds& ids = neighbourIds<D,T>(DetId(hit.detId()), topology_.get());
+      hit.reserveNeighbours(ids.size());
+      for( unsigned int i = 0; i < ids.size(); ++i ) {
+	if( ids[i] == DetId(0) ) continue;
+	associateNeighbour(ids[i],hit,hits,refProd,neighbourEta(i),neighbourPhi(i));
       }
-      else 
-	{
-	  navigator.home();
-	  E=navigator.east();
-	  NE=navigator.north();
-	}
-      associateNeighbour(NE,hit,hits,refProd,1,1);
-      navigator.home();
-
-      S = navigator.south();
-      associateNeighbour(S,hit,hits,refProd,0,-1);
-      
-      if (S !=DetId(0)) {
-	SW = navigator.west();
-      } else {
-	navigator.home();
-	W=navigator.west();
-	SW=navigator.south();
-      }
-      associateNeighbour(SW,hit,hits,refProd,-1,-1);
-      navigator.home();
-
-      E = navigator.east();
-      associateNeighbour(E,hit,hits,refProd,1,0);
-      
-      if (E !=DetId(0)) {
-	SE = navigator.south();
-      } else {
-	navigator.home();
-	S=navigator.south();
-	SE=navigator.east();
-      }
-      associateNeighbour(SE,hit,hits,refProd,1,-1);
-      navigator.home();
-
-
-      W = navigator.west();
-      associateNeighbour(W,hit,hits,refProd,-1,0);
-
-      if (W !=DetId(0)) {
-	NW = navigator.north();
-      } else {
-	navigator.home();
-	N=navigator.north();
-	NW=navigator.west();
-      }
-      associateNeighbour(NW,hit,hits,refProd,-1,1);
   }
 
 
@@ -21,6 +21,9 @@
 #include "Geometry/CaloGeometry/interface/TruncatedPyramid.h"
 #include "Geometry/Records/interface/CaloGeometryRecord.h"
 
+#include "RecoCaloTools/Navigation/interface/CaloNavigator.h"
+
+#include <array>
 #include <unordered_map>
 
 class PFRecHitNavigatorBase {
@@ -38,6 +41,93 @@ class PFRecHitNavigatorBase {
 
  protected:
 
+  // the 8 neighbours of a cell, in the order N, NE, S, SW, E, SE, W, NW
+  typedef std::array<DetId,8> NeighbourIds;
+  static short neighbourEta(unsigned int i) {
+    static constexpr short eta[8] = {0,1,0,-1,1,1,-1,-1};
+    return eta[i];
+  }
+  static short neighbourPhi(unsigned int i) {
+    static constexpr short phi[8] = {1,1,-1,-1,0,-1,0,1};
+    return phi[i];
+  }
+
+  // The neighbours depend only on the topology: they are navigated the first
+  // time a cell is seen and kept until resetNeighbourIds() is called for a
+  // new topology, instead of being navigated again for every hit of every
+  // event.
+  template<typename DET,typename TOPO>
+  const NeighbourIds& neighbourIds(const DetId& detid, const TOPO* topology) {
+    auto cached = neighbourIds_.find(detid.rawId());
+    if( cached != neighbourIds_.end() ) return cached->second;
+
+    NeighbourIds& ids = neighbourIds_[detid.rawId()];
+    CaloNavigator<DET> navigator(detid, topology);
+
+    DetId N(0);
+    DetId E(0);
+    DetId S(0);
+    DetId W(0);
+    DetId NW(0);
+    DetId NE(0);
+    DetId SW(0);
+    DetId SE(0);
+
+    N=navigator.north();  
+    ids[0]=N;
+
+    if (N !=DetId(0)) {
+      NE=navigator.east();
+    } else {
+      navigator.home();
+      E=navigator.east();
+      NE=navigator.north();
+    }
+    ids[1]=NE;
+    navigator.home();
+
+    S = navigator.south();
+    ids[2]=S;
+      
+    if (S !=DetId(0)) {
+      SW = navigator.west();
+    } else {
+      navigator.home();
+      W=navigator.west();
+      SW=navigator.south();
+    }
+    ids[3]=SW;
+    navigator.home();
+
+    E = navigator.east();
+    ids[4]=E;
+      
+    if (E !=DetId(0)) {
+      SE = navigator.south();
+    } else {
+      navigator.home();
+      S=navigator.south();
+      SE=navigator.east();
+    }
+    ids[5]=SE;
+    navigator.home();
+
+    W = navigator.west();
+    ids[6]=W;
+
+    if (W !=DetId(0)) {
+      NW = navigator.north();
+    } else {
+      navigator.home();
+      N=navigator.north();
+      NW=navigator.west();
+    }
+    ids[7]=NW;
+    return ids;
+  }
+
+  void resetNeighbourIds() { neighbourIds_.clear(); }
+
   void associateNeighbour(const DetId& id, reco::PFRecHit& hit,std::unique_ptr<reco::PFRecHitCollection>& hits,edm::RefProd<reco::PFRecHitCollection>& refProd,short eta, short phi,short depth) {
     auto found_hit = std::lower_bound(hits->begin(),hits->end(),
 				      id,
@@ -50,6 +140,8 @@ class PFRecHitNavigatorBase {
     }    
   }
 
+ private:
+  std::unordered_map<unsigned,NeighbourIds> neighbourIds_;
 
 };
 
@@ -101,6 +101,7 @@ buildClusters(const reco::PFClusterCollection& input,
   reco::PFClusterCollection clustersInTopo;
   for( const auto& topocluster : input ) {
     clustersInTopo.clear();
+    fillTopoRecHits(topocluster);
     seedPFClustersFromTopo(topocluster,seedable,clustersInTopo);
     const unsigned tolScal = 
       std::pow(std::max(1.0,clustersInTopo.size()-1.0),2.0);
@@ -126,6 +127,41 @@ buildClusters(const reco::PFClusterCollection& input,
   }
 }
 
+double Basic2DGenericPFlowClusterizer::
+recHitEnergyNorm(const reco::PFRecHit& rechit) const {
+  int cell_layer = (int)rechit.layer();
+  if( cell_layer == PFLayer::HCAL_BARREL2 && 
+      std::abs(rechit.positionREP().eta()) > 0.34 ) {
+    cell_layer *= 100;
+  }  
+
+  double recHitEnergyNorm=0.;
+  auto const& recHitEnergyNormDepthPair = _recHitEnergyNorms.find(cell_layer)->second;
+
+  for (unsigned int j=0; j<recHitEnergyNormDepthPair.second.size(); ++j) {
+    int depth=recHitEnergyNormDepthPair.first[j];
+
+    if( ( cell_layer == PFLayer::HCAL_BARREL1 && rechit.depth()== depth)
+	|| ( cell_layer == PFLayer::HCAL_ENDCAP && rechit.depth()== depth)
+	|| ( cell_layer != PFLayer::HCAL_ENDCAP && cell_layer != PFLayer::HCAL_BARREL1)
+	) recHitEnergyNorm = recHitEnergyNormDepthPair.second[j];
+  }
+  return recHitEnergyNorm;
+}
+
+void Basic2DGenericPFlowClusterizer::
+fillTopoRecHits(const reco::PFCluster& topo) {
+  _topoRecHits.clear();
+  for( const reco::PFRecHitFraction& rhf : topo.recHitFractions() ) {
+    const reco::PFRecHit& rechit = *rhf.recHitRef();
+    const math::XYZPoint pos(rechit.position());
+    _topoRecHits.x.push_back(pos.x());
+    _topoRecHits.y.push_back(pos.y());
+    _topoRecHits.z.push_back(pos.z());
+    _topoRecHits.energyNorm.push_back(recHitEnergyNorm(rechit));
+  }
+}
+
 void Basic2DGenericPFlowClusterizer::
 seedPFClustersFromTopo(const reco::PFCluster& topo,
 		       const std::vector<bool>& seedable,
@@ -173,38 +209,43 @@ growPFClusters(const reco::PFCluster& topo,
     }
     cluster.resetHitsAndFractions();
   }
+  // cluster positions, energies and seeds are fixed while the rechits are
+  // shared out: copy them once per iteration
+  const unsigned nclusters = clusters.size();
+  std::vector<double> clus_x(nclusters), clus_y(nclusters), clus_z(nclusters);
+  std::vector<double> clus_energy(nclusters);
+  std::vector<DetId> clus_seed(nclusters);
+  for( unsigned i = 0; i < nclusters; ++i ) {
+    const math::XYZPoint& clusterpos_xyz = clusters[i].position();
+    clus_x[i] = clusterpos_xyz.x();
+    clus_y[i] = clusterpos_xyz.y();
+    clus_z[i] = clusterpos_xyz.z();
+    clus_energy[i] = clusters[i].energy();
+    clus_seed[i] = clusters[i].seed();
+  }
   // loop over topo cluster and grow current PFCluster hypothesis 
-  std::vector<double> dist2, frac;
+  std::vector<double> dist2(nclusters), frac(nclusters);
   double fractot = 0;
-  for( const reco::PFRecHitFraction& rhf : topo.recHitFractions() ) {
-    const reco::PFRecHitRef& refhit = rhf.recHitRef();
-    int cell_layer = (int)refhit->layer();
-    if( cell_layer == PFLayer::HCAL_BARREL2 && 
-	std::abs(refhit->positionREP().eta()) > 0.34 ) {
-      cell_layer *= 100;
-    }  
-
-    math::XYZPoint topocellpos_xyz(refhit->position());
-    dist2.clear(); frac.clear(); fractot = 0;
-
-    double recHitEnergyNorm=0.;
-    auto const& recHitEnergyNormDepthPair = _recHitEnergyNorms.find(cell_layer)->second;
-
-    for (unsigned int j=0; j<recHitEnergyNormDepthPair.second.size(); ++j) {
-      int depth=recHitEnergyNormDepthPair.first[j];
+  const auto& topoRecHitFractions = topo.recHitFractions();
+  for( unsigned ihit = 0; ihit < topoRecHitFractions.size(); ++ihit ) {
+    const reco::PFRecHitRef& refhit = topoRecHitFractions[ihit].recHitRef();
+    const double cell_x = _topoRecHits.x[ihit];
+    const double cell_y = _topoRecHits.y[ihit];
+    const double cell_z = _topoRecHits.z[ihit];
+    const double recHitEnergyNorm = _topoRecHits.energyNorm[ihit];
+    const DetId cell_id = refhit->detId();
+    fractot = 0;
 
-      if( ( cell_layer == PFLayer::HCAL_BARREL1 && refhit->depth()== depth)
-	  || ( cell_layer == PFLayer::HCAL_ENDCAP && refhit->depth()== depth)
-	  || ( cell_layer != PFLayer::HCAL_ENDCAP && cell_layer != PFLayer::HCAL_BARREL1)
-	  ) recHitEnergyNorm = recHitEnergyNormDepthPair.second[j];
+    for( unsigned i = 0; i < nclusters; ++i ) {
+      const double dx = clus_x[i] - cell_x;
+      const double dy = clus_y[i] - cell_y;
+      const double dz = clus_z[i] - cell_z;
+      dist2[i] = (dx*dx + dy*dy + dz*dz)/_showerSigma2;
     }
 
     // add rechits to clusters, calculating fraction based on distance
-    for( auto& cluster : clusters ) {      
-      const math::XYZPoint& clusterpos_xyz = cluster.position();
-      const math::XYZVector deltav = clusterpos_xyz - topocellpos_xyz;
-      const double d2 = deltav.Mag2()/_showerSigma2;
-      dist2.emplace_back( d2 );
+    for( unsigned i = 0; i < nclusters; ++i ) {
+      const double d2 = dist2[i];
       if( d2 > 100 ) {
 	LOGDRESSED("Basic2DGenericPFlowClusterizer:growAndStabilizePFClusters")
 	  << "Warning! :: pfcluster-topocell distance is too large! d= "
@@ -213,19 +254,19 @@ growPFClusters(const reco::PFCluster& topo,
 
       // fraction assignment logic
       double fraction;
-      if( refhit->detId() == cluster.seed() && _excludeOtherSeeds ) {
+      if( cell_id == clus_seed[i] && _excludeOtherSeeds ) {
 	fraction = 1.0;	
       } else if ( seedable[refhit.key()] && _excludeOtherSeeds ) {
 	fraction = 0.0;
       } else {
-	fraction = cluster.energy()/recHitEnergyNorm * vdt::fast_expf( -0.5*d2 );
+	fraction = clus_energy[i]/recHitEnergyNorm * vdt::fast_expf( -0.5*d2 );
       }      
       fractot += fraction;
-      frac.emplace_back(fraction);
+      frac[i] = fraction;
     }
     for( unsigned i = 0; i < clusters.size(); ++i ) {      
       if( fractot > _minFracTot || 
-	  ( refhit->detId() == clusters[i].seed() && fractot > 0.0 ) ) {
+	  ( cell_id == clus_seed[i] && fractot > 0.0 ) ) {
 	frac[i]/=fractot;
       } else {
 	continue;
@@ -263,7 +304,7 @@ growPFClusters(const reco::PFCluster& topo,
     if( delta2 > diff2 ) diff2 = delta2;
   }
   diff = std::sqrt(diff2);
-  dist2.clear(); frac.clear(); clus_prev_pos.clear();// avoid badness
+  clus_prev_pos.clear();// avoid badness
   growPFClusters(topo,seedable,toleranceScaling,iter+1,diff,clusters);
 }
 
@@ -36,6 +36,17 @@ class Basic2DGenericPFlowClusterizer : public PFClusterBuilderBase {
   std::unordered_map<int,std::pair<std::vector<int>,std::vector<double> > > _recHitEnergyNorms;
   std::unique_ptr<PFCPositionCalculatorBase> _allCellsPosCalc;
   std::unique_ptr<PFCPositionCalculatorBase> _convergencePosCalc;
+
+  // per-rechit quantities of the current topo cluster that do not change
+  // during the position/fraction iterations, in the topo cluster order
+  struct TopoRecHits {
+    std::vector<double> x, y, z, energyNorm;
+    void clear() { x.clear(); y.clear(); z.clear(); energyNorm.clear(); }
+  };
+  TopoRecHits _topoRecHits;
+
+  double recHitEnergyNorm(const reco::PFRecHit&) const;
+  void fillTopoRecHits(const reco::PFCluster&);
   
   void seedPFClustersFromTopo(const reco::PFCluster&,
 			      const std::vector<bool>&,
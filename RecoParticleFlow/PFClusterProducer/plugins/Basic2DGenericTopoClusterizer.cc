@@ -22,6 +22,13 @@ buildClusters(const edm::Handle<reco::PFRecHitCollection>& input,
   std::vector<bool> used(hits.size(),false);
   std::vector<unsigned int> seeds;
   
+  // evaluate the thresholds once per rechit rather than each time the
+  // rechit is reached from a neighbour
+  std::vector<bool> aboveThreshold(hits.size(),false);
+  for( unsigned int i = 0; i < hits.size(); ++i ) {
+    if( rechitMask[i] ) aboveThreshold[i] = passesThresholds(hits[i]);
+  }
+
   // get the seeds and sort them descending in energy
   seeds.reserve(hits.size());  
   for( unsigned int i = 0; i < hits.size(); ++i ) {
@@ -36,18 +43,13 @@ buildClusters(const edm::Handle<reco::PFRecHitCollection>& input,
   for( auto seed : seeds ) {    
     if( !rechitMask[seed] || !seedable[seed] || used[seed] ) continue;    
     temp.reset();
-    buildTopoCluster(input,rechitMask,seed,used,temp);
+    buildTopoCluster(input,rechitMask,aboveThreshold,seed,used,temp);
     if( !temp.recHitFractions().empty() ) output.push_back(temp);
   }
 }
 
-void Basic2DGenericTopoClusterizer::
-buildTopoCluster(const edm::Handle<reco::PFRecHitCollection>& input,
-		 const std::vector<bool>& rechitMask,
-		 unsigned int kcell,
-		 std::vector<bool>& used,		 
-		 reco::PFCluster& topocluster) {
-  auto const & cell = (*input)[kcell];
+bool Basic2DGenericTopoClusterizer::
+passesThresholds(const reco::PFRecHit& cell) const {
   int cell_layer = (int)cell.layer();
   if( cell_layer == PFLayer::HCAL_BARREL2 && 
       std::abs(cell.positionREP().eta()) > 0.34 ) {
@@ -68,34 +70,60 @@ buildTopoCluster(const edm::Handle<reco::PFRecHitCollection>& input,
 
   }
 
-  if( cell.energy() < thresholdE ||
-      cell.pt2() < thresholdPT2  ) {
+  return !( cell.energy() < thresholdE || cell.pt2() < thresholdPT2 );
+}
+
+// depth-first growth from kcell through the unused, unmasked neighbours
+// above threshold; the explicit stack visits the rechits in the same order
+// as the recursion it replaces without its depth limit
+void Basic2DGenericTopoClusterizer::
+buildTopoCluster(const edm::Handle<reco::PFRecHitCollection>& input,
+		 const std::vector<bool>& rechitMask,
+		 const std::vector<bool>& aboveThreshold,
+		 unsigned int kcell,
+		 std::vector<bool>& used,		 
+		 reco::PFCluster& topocluster) {
+  auto const & hits = *input;
+  if( !aboveThreshold[kcell] ) {
     LOGDRESSED("GenericTopoCluster::buildTopoCluster()")
-      << "RecHit " << cell.detId() << " with enegy "
-      << cell.energy() << " GeV was rejected!." << std::endl;
+      << "RecHit " << hits[kcell].detId() << " with enegy "
+      << hits[kcell].energy() << " GeV was rejected!." << std::endl;
     return;
   }
 
-
-  auto k = kcell;
-  used[k] = true;
-  auto ref = makeRefhit(input,k);
-  topocluster.addRecHitFraction(reco::PFRecHitFraction(ref, 1.0));
+  used[kcell] = true;
+  topocluster.addRecHitFraction(reco::PFRecHitFraction(makeRefhit(input,kcell), 1.0));
+  _stack.clear();
+  _stack.emplace_back(kcell,0);
   
-  auto const & neighbours = 
-    ( _useCornerCells ? cell.neighbours8() : cell.neighbours4() );
-  
-  for( auto nb : neighbours ) {
+  while( !_stack.empty() ) {
+    auto& top = _stack.back();
+    auto const & cell = hits[top.first];
+    auto const & neighbours = 
+      ( _useCornerCells ? cell.neighbours8() : cell.neighbours4() );
+    if( top.second == neighbours.size() ) {
+      _stack.pop_back();
+      continue;
+    }
+    const unsigned int nb = neighbours.begin()[top.second++];
     if( used[nb] || !rechitMask[nb] ) {
       LOGDRESSED("GenericTopoCluster::buildTopoCluster()")
       	<< "  RecHit " << cell.detId() << "\'s" 
-	<< " neighbor RecHit " << input->at(nb).detId() 
+	<< " neighbor RecHit " << hits[nb].detId() 
 	<< " with enegy " 
-	<< input->at(nb).energy() << " GeV was rejected!" 
+	<< hits[nb].energy() << " GeV was rejected!" 
 	<< " Reasons : " << used[nb] << " (used) " 
 	<< !rechitMask[nb] << " (masked)." << std::endl;
       continue;
     }
-    buildTopoCluster(input,rechitMask,nb,used,topocluster);
+    if( !aboveThreshold[nb] ) {
+      LOGDRESSED("GenericTopoCluster::buildTopoCluster()")
+	<< "RecHit " << hits[nb].detId() << " with enegy "
+	<< hits[nb].energy() << " GeV was rejected!." << std::endl;
+      continue;
+    }
+    used[nb] = true;
+    topocluster.addRecHitFraction(reco::PFRecHitFraction(makeRefhit(input,nb), 1.0));
+    _stack.emplace_back(nb,0);
   }
 }
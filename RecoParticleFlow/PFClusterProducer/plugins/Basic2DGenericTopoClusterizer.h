@@ -22,12 +22,16 @@ class Basic2DGenericTopoClusterizer : public InitialClusteringStepBase {
   
  private:  
   const bool _useCornerCells;
+  bool passesThresholds(const reco::PFRecHit&) const;
   void buildTopoCluster(const edm::Handle<reco::PFRecHitCollection>&,
 			const std::vector<bool>&, // masked rechits
+			const std::vector<bool>&, // rechits above threshold
 			unsigned int, //present rechit
 			std::vector<bool>&, // hit usage state
 			reco::PFCluster&); // the topocluster
   
+  // work space for the depth-first growth: (rechit, next neighbour) pairs
+  std::vector<std::pair<unsigned int,unsigned int> > _stack;
 };
 
 DEFINE_EDM_PLUGIN(InitialClusteringStepFactory,
@@ -1,4 +1,6 @@
 #include "FWCore/Framework/interface/MakerMacros.h"
+#include "FWCore/Framework/interface/ESWatcher.h"
+#include "Geometry/Records/interface/HcalRecNumberingRecord.h"
 
 #include "RecoParticleFlow/PFClusterProducer/interface/PFRecHitFakeNavigator.h"
 
@@ -18,10 +20,16 @@ class PFRecHitEcalBarrelNavigatorWithTime : public PFRecHitCaloNavigatorWithTime
     }
 
   void beginEvent(const edm::EventSetup& iSetup) override {
+    // the topology and the cached neighbours only change with the geometry
+    if( !geomWatcher_.check(iSetup) ) return;
     edm::ESHandle<CaloGeometry> geoHandle;
     iSetup.get<CaloGeometryRecord>().get(geoHandle);
     topology_.reset( new EcalBarrelTopology(geoHandle) );
+    resetNeighbourIds();
   }
+
+ private:
+  edm::ESWatcher<CaloGeometryRecord> geomWatcher_;
 };
 
 class PFRecHitEcalEndcapNavigatorWithTime : public PFRecHitCaloNavigatorWithTime<EEDetId,EcalEndcapTopology> {
@@ -33,10 +41,16 @@ class PFRecHitEcalEndcapNavigatorWithTime : public PFRecHitCaloNavigatorWithTime
     }
 
   void beginEvent(const edm::EventSetup& iSetup) override {
+    // the topology and the cached neighbours only change with the geometry
+    if( !geomWatcher_.check(iSetup) ) return;
     edm::ESHandle<CaloGeometry> geoHandle;
     iSetup.get<CaloGeometryRecord>().get(geoHandle);
     topology_.reset( new EcalEndcapTopology(geoHandle) );
+    resetNeighbourIds();
   }
+
+ private:
+  edm::ESWatcher<CaloGeometryRecord> geomWatcher_;
 };
 
 class PFRecHitEcalBarrelNavigator final : public PFRecHitCaloNavigator<EBDetId,EcalBarrelTopology> {
@@ -46,10 +60,16 @@ class PFRecHitEcalBarrelNavigator final : public PFRecHitCaloNavigator<EBDetId,E
   }
 
   void beginEvent(const edm::EventSetup& iSetup) override {
+    // the topology and the cached neighbours only change with the geometry
+    if( !geomWatcher_.check(iSetup) ) return;
     edm::ESHandle<CaloGeometry> geoHandle;
     iSetup.get<CaloGeometryRecord>().get(geoHandle);
     topology_.reset( new EcalBarrelTopology(geoHandle) );
+    resetNeighbourIds();
   }
+
+ private:
+  edm::ESWatcher<CaloGeometryRecord> geomWatcher_;
 };
 
 class PFRecHitEcalEndcapNavigator final : public PFRecHitCaloNavigator<EEDetId,EcalEndcapTopology> {
@@ -59,10 +79,16 @@ class PFRecHitEcalEndcapNavigator final : public PFRecHitCaloNavigator<EEDetId,E
   }
 
   void beginEvent(const edm::EventSetup& iSetup) override {
+    // the topology and the cached neighbours only change with the geometry
+    if( !geomWatcher_.check(iSetup) ) return;
     edm::ESHandle<CaloGeometry> geoHandle;
     iSetup.get<CaloGeometryRecord>().get(geoHandle);
     topology_.reset( new EcalEndcapTopology(geoHandle) );
+    resetNeighbourIds();
   }
+
+ private:
+  edm::ESWatcher<CaloGeometryRecord> geomWatcher_;
 };
 
 class PFRecHitPreshowerNavigator final : public PFRecHitCaloNavigator<ESDetId,EcalPreshowerTopology> {
@@ -73,10 +99,16 @@ class PFRecHitPreshowerNavigator final : public PFRecHitCaloNavigator<ESDetId,Ec
 
 
   void beginEvent(const edm::EventSetup& iSetup) override {
+    // the topology and the cached neighbours only change with the geometry
+    if( !geomWatcher_.check(iSetup) ) return;
     edm::ESHandle<CaloGeometry> geoHandle;
     iSetup.get<CaloGeometryRecord>().get(geoHandle);
     topology_.reset( new EcalPreshowerTopology(geoHandle) );
+    resetNeighbourIds();
   }
+
+ private:
+  edm::ESWatcher<CaloGeometryRecord> geomWatcher_;
 };
 
 
@@ -88,11 +120,16 @@ class PFRecHitHCALNavigator final : public PFRecHitCaloNavigator<HcalDetId,HcalT
 
 
   void beginEvent(const edm::EventSetup& iSetup) override {    
+      if( !topoWatcher_.check(iSetup) ) return;
       edm::ESHandle<HcalTopology> hcalTopology;
       iSetup.get<HcalRecNumberingRecord>().get( hcalTopology );
       topology_.release();
       topology_.reset(hcalTopology.product());
+      resetNeighbourIds();
   }
+
+ private:
+  edm::ESWatcher<HcalRecNumberingRecord> topoWatcher_;
 };
 class PFRecHitHCALNavigatorWithTime : public PFRecHitCaloNavigatorWithTime<HcalDetId,HcalTopology,false> {
  public:
@@ -104,11 +141,16 @@ class PFRecHitHCALNavigatorWithTime : public PFRecHitCaloNavigatorWithTime<HcalD
 
 
   void beginEvent(const edm::EventSetup& iSetup) override {    
+      if( !topoWatcher_.check(iSetup) ) return;
       edm::ESHandle<HcalTopology> hcalTopology;
       iSetup.get<HcalRecNumberingRecord>().get( hcalTopology );
       topology_.release();
       topology_.reset(hcalTopology.product());
+      resetNeighbourIds();
   }
+
+ private:
+  edm::ESWatcher<HcalRecNumberingRecord> topoWatcher_;
 };
 
 
@@ -120,11 +162,16 @@ class PFRecHitCaloTowerNavigator : public PFRecHitCaloNavigator<CaloTowerDetId,C
 
 
   void beginEvent(const edm::EventSetup& iSetup) override {
+    if( !topoWatcher_.check(iSetup) ) return;
     edm::ESHandle<CaloTowerTopology> caloTowerTopology;
     iSetup.get<HcalRecNumberingRecord>().get(caloTowerTopology);
     topology_.release();
     topology_.reset(caloTowerTopology.product());
+    resetNeighbourIds();
   }
+
+ private:
+  edm::ESWatcher<HcalRecNumberingRecord> topoWatcher_;
 };
 
 typedef PFRecHitDualNavigator<PFLayer::ECAL_BARREL,
@@ -123,6 +123,9 @@ class PFBlockAlgo {
 
   /// sets debug printout flag
   void setDebug( bool debug ) {debug_ = debug;}
+
+  /// run the pairwise link tests concurrently before the (serial) union
+  void setParallelLinkTests( bool parallel ) {parallelLinkTests_ = parallel;}
   
   /// \return collection of blocks
   /*   const  reco::PFBlockCollection& blocks() const {return *blocks_;} */
@@ -161,6 +164,9 @@ class PFBlockAlgo {
   
   /// if true, debug printouts activated
   bool   debug_;
+
+  /// if true, the link tests of findBlocks run in parallel over elements
+  bool   parallelLinkTests_;
   
   friend std::ostream& operator<<(std::ostream&, const PFBlockAlgo&);
   bool useHO_;
@@ -6,6 +6,9 @@ particleFlowBlock = cms.EDProducer(
     verbose = cms.untracked.bool(False),
     # Debug flag
     debug = cms.untracked.bool(False),
+    # run the element link tests in parallel (same blocks, more CPU for
+    # pairs the serial loop skips once they are already connected)
+    parallelLinkTests = cms.untracked.bool(False),
     
     #define what we are importing into particle flow
     #from the various subdetectors
@@ -11,6 +11,9 @@
 #include <algorithm>
 #include "TMath.h"
 
+#include "tbb/task_arena.h"
+#include "tbb/tbb.h"
+
 using namespace std;
 using namespace reco;
 
@@ -67,6 +70,7 @@ namespace {
 PFBlockAlgo::PFBlockAlgo() : 
   blocks_( new reco::PFBlockCollection ),  
   debug_(false),
+  parallelLinkTests_(false),
   elementTypes_( {
         INIT_ENTRY(PFBlockElement::TRACK),
 	INIT_ENTRY(PFBlockElement::PS1),
@@ -162,24 +166,60 @@ void PFBlockAlgo::findBlocks() {
   else                blocks_.reset( new reco::PFBlockCollection );
   blocks_->reserve(elements_.size());
 
-  QuickUnion qu(bare_elements_.size());
-  const auto elem_size = bare_elements_.size();
-  for( unsigned i = 0; i < elem_size; ++i ) {
-    for( unsigned j = 0; j < elem_size; ++j ) {
-      if( qu.connected(i,j) || j == i ) continue;
-      if( !linkTests_[linkTestSquare_[bare_elements_[i]->type()][bare_elements_[j]->type()]] ) {
-        j = ranges_[bare_elements_[j]->type()].second;
-        continue;
+  constexpr unsigned rowsize = reco::PFBlockElement::kNBETypes;
+  const unsigned elem_size = bare_elements_.size();
+
+  // elements are sorted by type and ranges_ holds the [first,last] index of
+  // each type (see buildElements): for each type, find the present types it
+  // has a link test with, so that the pair loops only visit elements that
+  // can be linked (an absent type has the range [0,0] too)
+  auto present = [&](unsigned type) {
+    return elem_size > 0 && bare_elements_[ranges_[type].first]->type() == type;
+  };
+  std::array<std::vector<unsigned>,rowsize> linkableTypes;
+  for( unsigned t1 = 0; t1 < rowsize; ++t1 ) {
+    for( unsigned t2 = 0; t2 < rowsize; ++t2 ) {
+      if( linkTests_[linkTestSquare_[t1][t2]] && present(t2) ) {
+        linkableTypes[t1].push_back(t2);
       }
-      auto p1(bare_elements_[i]), p2(bare_elements_[j]);
-      const PFBlockElement::Type type1 = p1->type();
-      const PFBlockElement::Type type2 = p2->type();
-      const unsigned index = linkTestSquare_[type1][type2];
-      if( linkTests_[index]->linkPrefilter(p1,p2) ) {
-        const double dist = linkTests_[index]->testLink(p1,p2);
-        // compute linking info if it is possible
-        if( dist > -0.5 ) {
-          qu.unite(i,j);
+    }
+  }
+  auto linked = [&](unsigned i, unsigned j) {
+    auto p1(bare_elements_[i]), p2(bare_elements_[j]);
+    const unsigned index = linkTestSquare_[p1->type()][p2->type()];
+    return ( linkTests_[index]->linkPrefilter(p1,p2) &&
+             linkTests_[index]->testLink(p1,p2) > -0.5 );
+  };
+
+  QuickUnion qu(elem_size);
+  if( parallelLinkTests_ ) {
+    // evaluate all the link tests concurrently, then unite the linked pairs
+    // in the same order as the serial loop below: the blocks are identical
+    std::vector<std::vector<unsigned> > linksOf(elem_size);
+    tbb::this_task_arena::isolate([&] {
+      tbb::parallel_for(
+        tbb::blocked_range<unsigned>(0, elem_size, 16),
+        [&](const tbb::blocked_range<unsigned>& r) {
+          for( unsigned i = r.begin(); i != r.end(); ++i ) {
+            for( unsigned t2 : linkableTypes[bare_elements_[i]->type()] ) {
+              for( unsigned j = ranges_[t2].first; j <= ranges_[t2].second; ++j ) {
+                if( j != i && linked(i,j) ) linksOf[i].push_back(j);
+              }
+            }
+          }
+        });
+    });
+    for( unsigned i = 0; i < elem_size; ++i ) {
+      for( unsigned j : linksOf[i] ) {
+        if( !qu.connected(i,j) ) qu.unite(i,j);
+      }
+    }
+  } else {
+    for( unsigned i = 0; i < elem_size; ++i ) {
+      for( unsigned t2 : linkableTypes[bare_elements_[i]->type()] ) {
+        for( unsigned j = ranges_[t2].first; j <= ranges_[t2].second; ++j ) {
+          if( j == i || qu.connected(i,j) ) continue;
+          if( linked(i,j) ) qu.unite(i,j);
         }
       }
     }
@@ -9,6 +9,8 @@
 
 #include <cmath>
 #include <array>
+#include <utility>
+#include <vector>
 
 class CACellStatus {
 
@@ -33,6 +35,36 @@ public:
   
 };
 
+// Outer neighbors of all the cells of a region in compressed sparse row form:
+// the neighbors of cell i are theNeighbors[theOffsets[i]] ... theNeighbors[theOffsets[i+1]-1].
+// The storage is owned by the CellularAutomaton and reused across regions and events.
+class CACellNeighbors {
+
+public:
+
+  void clear() {
+    theOffsets.clear();
+    theNeighbors.clear();
+  }
+
+  unsigned int size(unsigned int cellId) const {
+    return theOffsets[cellId+1] - theOffsets[cellId];
+  }
+
+  const unsigned int * begin(unsigned int cellId) const {
+    return theNeighbors.data() + theOffsets[cellId];
+  }
+
+  const unsigned int * end(unsigned int cellId) const {
+    return theNeighbors.data() + theOffsets[cellId+1];
+  }
+
+ public:
+  std::vector<unsigned int> theOffsets;
+  std::vector<unsigned int> theNeighbors;
+
+};
+
 class CACell {
 public:
   using Hit = RecHitsSortedInPhi::Hit;
@@ -40,6 +72,8 @@ public:
   using CAntuplet = std::vector<unsigned int>;
   using CAColl = std::vector<CACell>;
   using CAStatusColl = std::vector<CACellStatus>;
+  // (inner cell, outer cell) connection found while checking the alignment
+  using CAEdge = std::pair<unsigned int, unsigned int>;
   
   
   CACell(const HitDoublets* doublets, int doubletId, const int innerHitId, const int outerHitId) :
@@ -99,14 +133,14 @@ public:
     return theDoublets->phi(theDoubletId, HitDoublets::outer);
   }
   
-  void evolve(unsigned int me, CAStatusColl& allStatus) {
+  void evolve(unsigned int me, const CACellNeighbors& neighbors, CAStatusColl& allStatus) const {
     
     allStatus[me].hasSameStateNeighbors = 0;
     auto mystate = allStatus[me].theCAState;
     
-    for (auto oc : theOuterNeighbors ) {
+    for (auto oc = neighbors.begin(me); oc != neighbors.end(me); ++oc) {
       
-      if (allStatus[oc].getCAState() == mystate) {
+      if (allStatus[*oc].getCAState() == mystate) {
 	
 	allStatus[me].hasSameStateNeighbors = 1;
 	
@@ -117,10 +151,14 @@ public:
   }
   
 
-  void checkAlignmentAndAct(CAColl& allCells, CAntuple & innerCells, const float ptmin, const float region_origin_x,
+  // innerCells are the cells whose outer hit is the inner hit of this cell,
+  // act(innerCell, thisCell) is called for each of them compatible with this cell.
+  // Only reads the other cells, so that cells of different layer pairs can be
+  // connected concurrently.
+  template<typename Act>
+  void checkAlignmentAndAct(const CAColl& allCells, const unsigned int * innerCells, const int ncells, const float ptmin, const float region_origin_x,
 			    const float region_origin_y, const float region_origin_radius, const float thetaCut,
-			    const float phiCut, const float hardPtCut, std::vector<CACell::CAntuplet> * foundTriplets) {
-    int ncells = innerCells.size();
+			    const float phiCut, const float hardPtCut, Act act) const {
     int constexpr VSIZE = 16;
     int ok[VSIZE];
     float r1[VSIZE];
@@ -142,10 +180,7 @@ public:
 	auto & oc =  allCells[koc]; 
 	if (ok[j]&&haveSimilarCurvature(oc,ptmin, region_origin_x, region_origin_y,
 					region_origin_radius, phiCut, hardPtCut)) {
-	  if (foundTriplets) foundTriplets->emplace_back(CACell::CAntuplet{koc,cellId});
-	  else {
-	    oc.tagAsOuterNeighbor(cellId);
-	  }
+	  act(koc, cellId);
 	}
       }
     };
@@ -155,19 +190,22 @@ public:
     
   }
   
-  void checkAlignmentAndTag(CAColl& allCells, CAntuple & innerCells, const float ptmin, const float region_origin_x,
-			    const float region_origin_y, const float region_origin_radius, const float thetaCut,
-			    const float phiCut, const float hardPtCut) {
-    checkAlignmentAndAct(allCells, innerCells, ptmin, region_origin_x, region_origin_y, region_origin_radius, thetaCut,
-			 phiCut, hardPtCut, nullptr);
+  void checkAlignmentAndTag(const CAColl& allCells, const unsigned int * innerCells, const int ncells, std::vector<CAEdge>& foundEdges,
+			    const float ptmin, const float region_origin_x, const float region_origin_y,
+			    const float region_origin_radius, const float thetaCut, const float phiCut,
+			    const float hardPtCut) const {
+    checkAlignmentAndAct(allCells, innerCells, ncells, ptmin, region_origin_x, region_origin_y, region_origin_radius, thetaCut,
+			 phiCut, hardPtCut,
+			 [&foundEdges](unsigned int inner, unsigned int outer) { foundEdges.emplace_back(inner, outer); });
     
   }
-  void checkAlignmentAndPushTriplet(CAColl& allCells, CAntuple & innerCells, std::vector<CACell::CAntuplet>& foundTriplets,
+  void checkAlignmentAndPushTriplet(const CAColl& allCells, const unsigned int * innerCells, const int ncells, std::vector<CACell::CAntuplet>& foundTriplets,
 				    const float ptmin, const float region_origin_x, const float region_origin_y,
 				    const float region_origin_radius, const float thetaCut, const float phiCut,
-				    const float hardPtCut) {
-    checkAlignmentAndAct(allCells, innerCells, ptmin, region_origin_x, region_origin_y, region_origin_radius, thetaCut,
-			 phiCut, hardPtCut, &foundTriplets);
+				    const float hardPtCut) const {
+    checkAlignmentAndAct(allCells, innerCells, ncells, ptmin, region_origin_x, region_origin_y, region_origin_radius, thetaCut,
+			 phiCut, hardPtCut,
+			 [&foundTriplets](unsigned int inner, unsigned int outer) { foundTriplets.emplace_back(CACell::CAntuplet{inner,outer}); });
   }
   
   
@@ -183,12 +221,6 @@ public:
   }
   
   
-  void tagAsOuterNeighbor(unsigned int otherCell)
-  {
-    theOuterNeighbors.push_back(otherCell);
-  }
-  
-  
   bool haveSimilarCurvature(const CACell & otherCell, const float ptmin,
 			    const float region_origin_x, const float region_origin_y, const float region_origin_radius, const float phiCut, const float hardPtCut) const
   {
@@ -261,7 +293,8 @@ public:
   // trying to free the track building process from hardcoded layers, leaving the visit of the graph
   // based on the neighborhood connections between cells.
   
-  void findNtuplets(CAColl& allCells, std::vector<CAntuplet>& foundNtuplets, CAntuplet& tmpNtuplet, const unsigned int minHitsPerNtuplet) const {
+  void findNtuplets(const CAColl& allCells, const CACellNeighbors& neighbors, unsigned int me,
+		    std::vector<CAntuplet>& foundNtuplets, CAntuplet& tmpNtuplet, const unsigned int minHitsPerNtuplet) const {
     
     // the building process for a track ends if:
     // it has no outer neighbor
@@ -274,10 +307,9 @@ public:
       }
     else
       {
-	unsigned int numberOfOuterNeighbors = theOuterNeighbors.size();
-	for (unsigned int i = 0; i < numberOfOuterNeighbors; ++i) {
-	  tmpNtuplet.push_back((theOuterNeighbors[i]));
-	  allCells[theOuterNeighbors[i]].findNtuplets(allCells,foundNtuplets, tmpNtuplet, minHitsPerNtuplet);
+	for (auto oc = neighbors.begin(me); oc != neighbors.end(me); ++oc) {
+	  tmpNtuplet.push_back(*oc);
+	  allCells[*oc].findNtuplets(allCells, neighbors, *oc, foundNtuplets, tmpNtuplet, minHitsPerNtuplet);
 	  tmpNtuplet.pop_back();
 	}
       }
@@ -287,8 +319,6 @@ public:
   
 private:
   
-  CAntuple theOuterNeighbors;
-  
   const HitDoublets* theDoublets;  
   const int theDoubletId;
   
@@ -8,9 +8,8 @@
 struct CALayer
 {
 	CALayer(const std::string& layerName, std::size_t numberOfHits )
-	: theName(layerName)
+	: theNumberOfHits(numberOfHits), theName(layerName)
 	{
-		isOuterHitOfCell.resize(numberOfHits);
 	}
 
 	bool operator==(const std::string& otherString)
@@ -28,7 +27,8 @@ struct CALayer
 
 	std::vector<int> theOuterLayers;
 	std::vector<int> theInnerLayers;
-	std::vector< std::vector<unsigned int> >  isOuterHitOfCell;
+	// the cells ending on each hit are indexed by the CellularAutomaton
+	std::size_t theNumberOfHits;
 
 
 private:
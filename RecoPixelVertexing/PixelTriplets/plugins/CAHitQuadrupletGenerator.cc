@@ -118,7 +118,6 @@ namespace {
 		g.theLayers[i].theInnerLayerPairs.clear();
 		g.theLayers[i].theOuterLayers.clear();
 		g.theLayers[i].theOuterLayerPairs.clear();
-		for (auto & v : g.theLayers[i].isOuterHitOfCell) v.clear();
 	}
 
   }
@@ -205,7 +204,8 @@ void CAHitQuadrupletGenerator::hitNtuplets(const IntermediateHitDoublets& region
 
 	  fillGraph(layers, regionLayerPairs, g, hitDoublets);
 
-	CellularAutomaton ca(g);
+	auto & ca = theCellularAutomaton;
+	ca.reset(g);
 
 	ca.createAndConnectCells(hitDoublets, region, caThetaCut,
 			caPhiCut, caHardPtCut);
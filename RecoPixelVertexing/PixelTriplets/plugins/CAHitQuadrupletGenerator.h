@@ -9,6 +9,7 @@
 #include "RecoTracker/TkMSParametrization/interface/LongitudinalBendingCorrection.h"
 #include "DataFormats/SiPixelDetId/interface/PixelSubdetector.h"
 #include "CAGraph.h"
+#include "CellularAutomaton.h"
 
 
 #include "RecoTracker/TkHitPairs/interface/HitPairGeneratorFromLayerPair.h"
@@ -57,6 +58,9 @@ private:
 
     std::unique_ptr<SeedComparitor> theComparitor;
 
+    // cell and connection storage reused across regions and events
+    CellularAutomaton theCellularAutomaton;
+
     class QuantityDependsPtEval {
     public:
 
@@ -117,7 +117,6 @@ namespace {
 		g.theLayers[i].theInnerLayerPairs.clear();
 		g.theLayers[i].theOuterLayers.clear();
 		g.theLayers[i].theOuterLayerPairs.clear();
-		for (auto & v : g.theLayers[i].isOuterHitOfCell) v.clear();
 	}
 
   }
@@ -201,7 +200,8 @@ void CAHitTripletGenerator::hitNtuplets(const IntermediateHitDoublets& regionDou
   		clearGraphStructure(layers, g);
 	}
 	fillGraph(layers, regionLayerPairs, g, hitDoublets);
-	CellularAutomaton ca(g);
+	auto & ca = theCellularAutomaton;
+	ca.reset(g);
 	ca.findTriplets(hitDoublets, foundTriplets, region, caThetaCut, caPhiCut,
                         caHardPtCut);
 
@@ -1,32 +1,58 @@
 #include "CellularAutomaton.h"
 
 #include<queue>
+#include<numeric>
 
+#include "tbb/task_arena.h"
+#include "tbb/tbb.h"
 
-void CellularAutomaton::createAndConnectCells(const std::vector<const HitDoublets *>& hitDoublets, const TrackingRegion& region,
-		const float thetaCut, const float phiCut, const float hardPtCut)
+namespace
+{
+	// offsets[i+1] holds the number of entries of i: turn it into the first slot of i
+	void countsToOffsets(std::vector<unsigned int>& offsets)
+	{
+		std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+	}
+
+	// the offsets have been used as fill cursors (offsets[i]++),
+	// shift them back to the first slot of i
+	void restoreOffsets(std::vector<unsigned int>& offsets)
+	{
+		for (auto i = offsets.size() - 1; i > 0; --i)
+		{
+			offsets[i] = offsets[i - 1];
+		}
+		offsets[0] = 0;
+	}
+}
+
+
+void CellularAutomaton::reset(CAGraph& graph)
+{
+	theLayerGraph = &graph;
+	allCells.clear();
+	allStatus.clear();
+	theOuterNeighbors.clear();
+	theLayerPairsInOrder.clear();
+	theRootCells.clear();
+}
+
+
+void CellularAutomaton::createCells(const std::vector<const HitDoublets *>& hitDoublets)
 {
-        int tsize=0;
+	auto & layerGraph = *theLayerGraph;
+        unsigned int tsize=0;
         for ( auto hd :  hitDoublets) tsize+=hd->size();
         allCells.reserve(tsize);
         unsigned int cellId = 0;
-	float ptmin = region.ptMin();
-	float region_origin_x = region.origin().x();
-	float region_origin_y = region.origin().y();
-	float region_origin_radius = region.originRBound();
 
-	std::vector<bool> alreadyVisitedLayerPairs;
-	alreadyVisitedLayerPairs.resize(theLayerGraph.theLayerPairs.size());
-	for (auto visited : alreadyVisitedLayerPairs)
-	{
-		visited = false;
-	}
-	for (int rootVertex : theLayerGraph.theRootLayers)
+	std::vector<bool> alreadyVisitedLayerPairs(layerGraph.theLayerPairs.size(), false);
+	for (int rootVertex : layerGraph.theRootLayers)
 	{
 
 		std::queue<int> LayerPairsToVisit;
 
-		for (int LayerPair : theLayerGraph.theLayers[rootVertex].theOuterLayerPairs)
+		for (int LayerPair : layerGraph.theLayers[rootVertex].theOuterLayerPairs)
 		{
 			LayerPairsToVisit.push(LayerPair);
 
@@ -38,9 +64,9 @@ void CellularAutomaton::createAndConnectCells(const std::vector<const HitDoublet
 		while (!LayerPairsToVisit.empty())
 		{
 			auto currentLayerPair = LayerPairsToVisit.front();
-			auto & currentLayerPairRef = theLayerGraph.theLayerPairs[currentLayerPair];
-			auto & currentInnerLayerRef = theLayerGraph.theLayers[currentLayerPairRef.theLayers[0]];
-			auto & currentOuterLayerRef = theLayerGraph.theLayers[currentLayerPairRef.theLayers[1]];
+			auto & currentLayerPairRef = layerGraph.theLayerPairs[currentLayerPair];
+			auto & currentInnerLayerRef = layerGraph.theLayers[currentLayerPairRef.theLayers[0]];
+			auto & currentOuterLayerRef = layerGraph.theLayers[currentLayerPairRef.theLayers[1]];
 			bool allInnerLayerPairsAlreadyVisited	{ true };
 
 			for (auto innerLayerPair : currentInnerLayerRef.theInnerLayerPairs)
@@ -63,22 +89,11 @@ void CellularAutomaton::createAndConnectCells(const std::vector<const HitDoublet
 				  allCells.emplace_back(doubletLayerPairId, i,
 							doubletLayerPairId->innerHitId(i),
 							doubletLayerPairId->outerHitId(i));
-				  
-										  
-				  currentOuterLayerRef.isOuterHitOfCell[doubletLayerPairId->outerHitId(i)].push_back(cellId);
-														     
 				  cellId++;
-
-				  auto & neigCells = currentInnerLayerRef.isOuterHitOfCell[doubletLayerPairId->innerHitId(i)];
-				  allCells.back().checkAlignmentAndTag(allCells,
-								       neigCells, ptmin, region_origin_x,
-								       region_origin_y, region_origin_radius, thetaCut,
-								       phiCut, hardPtCut
-								       );
-				  
-
 				}
 				assert(cellId==currentLayerPairRef.theFoundCells[1]);
+				theLayerPairsInOrder.push_back(currentLayerPair);
+
 				for (auto outerLayerPair : currentOuterLayerRef.theOuterLayerPairs)
 				{
 					LayerPairsToVisit.push(outerLayerPair);
@@ -99,6 +114,113 @@ void CellularAutomaton::createAndConnectCells(const std::vector<const HitDoublet
 
 }
 
+void CellularAutomaton::indexOuterHits(const std::vector<const HitDoublets *>& hitDoublets)
+{
+	// counting sort of the cells by layer and outer hit; the cells of a hit
+	// keep the creation order, so the layer pairs whose inner layer is this
+	// one see the same cells in the same order as when they were created
+	auto & layerGraph = *theLayerGraph;
+	const auto numberOfLayers = layerGraph.theLayers.size();
+	theOuterHitOffsets.resize(numberOfLayers);
+	theOuterHitCells.resize(numberOfLayers);
+	for (unsigned int i = 0; i < numberOfLayers; ++i)
+	{
+		theOuterHitOffsets[i].assign(layerGraph.theLayers[i].theNumberOfHits + 1, 0);
+	}
+
+	for (auto layerPair : theLayerPairsInOrder)
+	{
+		auto & offsets = theOuterHitOffsets[layerGraph.theLayerPairs[layerPair].theLayers[1]];
+		const HitDoublets* doublets = hitDoublets[layerPair];
+		for (unsigned int i = 0; i < doublets->size(); ++i)
+		{
+			++offsets[doublets->outerHitId(i) + 1];
+		}
+	}
+	for (unsigned int i = 0; i < numberOfLayers; ++i)
+	{
+		countsToOffsets(theOuterHitOffsets[i]);
+		theOuterHitCells[i].resize(theOuterHitOffsets[i].back());
+	}
+
+	for (auto layerPair : theLayerPairsInOrder)
+	{
+		auto const & layerPairRef = layerGraph.theLayerPairs[layerPair];
+		auto & offsets = theOuterHitOffsets[layerPairRef.theLayers[1]];
+		auto & cells = theOuterHitCells[layerPairRef.theLayers[1]];
+		const HitDoublets* doublets = hitDoublets[layerPair];
+		for (unsigned int i = 0; i < doublets->size(); ++i)
+		{
+			cells[offsets[doublets->outerHitId(i)]++] = layerPairRef.theFoundCells[0] + i;
+		}
+	}
+	for (unsigned int i = 0; i < numberOfLayers; ++i)
+	{
+		restoreOffsets(theOuterHitOffsets[i]);
+	}
+}
+
+void CellularAutomaton::createAndConnectCells(const std::vector<const HitDoublets *>& hitDoublets, const TrackingRegion& region,
+		const float thetaCut, const float phiCut, const float hardPtCut)
+{
+	float ptmin = region.ptMin();
+	float region_origin_x = region.origin().x();
+	float region_origin_y = region.origin().y();
+	float region_origin_radius = region.originRBound();
+
+	createCells(hitDoublets);
+	indexOuterHits(hitDoublets);
+
+	// the cells of a layer pair only read the cells ending on its inner layer:
+	// the layer pairs are connected concurrently, each into its own edge list
+	auto & layerGraph = *theLayerGraph;
+	const auto numberOfLayerPairs = theLayerPairsInOrder.size();
+	theFoundEdges.resize(numberOfLayerPairs);
+	tbb::this_task_arena::isolate([&] {
+		tbb::parallel_for(std::size_t(0), numberOfLayerPairs, [&](std::size_t ip) {
+			auto & edges = theFoundEdges[ip];
+			edges.clear();
+			auto const & layerPairRef = layerGraph.theLayerPairs[theLayerPairsInOrder[ip]];
+			auto const & offsets = theOuterHitOffsets[layerPairRef.theLayers[0]];
+			auto const & cells = theOuterHitCells[layerPairRef.theLayers[0]];
+			const HitDoublets* doublets = hitDoublets[theLayerPairsInOrder[ip]];
+			for (auto cellId = layerPairRef.theFoundCells[0]; cellId < layerPairRef.theFoundCells[1]; ++cellId)
+			{
+				auto innerHit = doublets->innerHitId(cellId - layerPairRef.theFoundCells[0]);
+				allCells[cellId].checkAlignmentAndTag(allCells,
+								      cells.data() + offsets[innerHit], offsets[innerHit + 1] - offsets[innerHit],
+								      edges, ptmin, region_origin_x,
+								      region_origin_y, region_origin_radius, thetaCut,
+								      phiCut, hardPtCut);
+			}
+		});
+	});
+
+	// merge the edges into the adjacency arrays, following the creation order
+	// so that the neighbors of each cell are sorted as the cells themselves
+	auto & offsets = theOuterNeighbors.theOffsets;
+	auto & neighbors = theOuterNeighbors.theNeighbors;
+	offsets.assign(allCells.size() + 1, 0);
+	for (std::size_t ip = 0; ip < numberOfLayerPairs; ++ip)
+	{
+		for (auto const & edge : theFoundEdges[ip])
+		{
+			++offsets[edge.first + 1];
+		}
+	}
+	countsToOffsets(offsets);
+	neighbors.resize(offsets.back());
+	for (std::size_t ip = 0; ip < numberOfLayerPairs; ++ip)
+	{
+		for (auto const & edge : theFoundEdges[ip])
+		{
+			neighbors[offsets[edge.first]++] = edge.second;
+		}
+	}
+	restoreOffsets(offsets);
+
+}
+
 void CellularAutomaton::evolve(const unsigned int minHitsPerNtuplet)
 {
   allStatus.resize(allCells.size());
@@ -109,15 +231,15 @@ void CellularAutomaton::evolve(const unsigned int minHitsPerNtuplet)
   for (unsigned int iteration = 0; iteration < numberOfIterations - 1;
        ++iteration)
     {
-      for (auto& layerPair : theLayerGraph.theLayerPairs)
+      for (auto& layerPair : theLayerGraph->theLayerPairs)
 	{
 	  for (auto i =layerPair.theFoundCells[0]; i<layerPair.theFoundCells[1]; ++i)
 	    {
-	      allCells[i].evolve(i,allStatus);
+	      allCells[i].evolve(i,theOuterNeighbors,allStatus);
 	    }
 	}
       
-      for (auto& layerPair : theLayerGraph.theLayerPairs)
+      for (auto& layerPair : theLayerGraph->theLayerPairs)
 	{
 	  for (auto i =layerPair.theFoundCells[0]; i<layerPair.theFoundCells[1]; ++i)
 	    {
@@ -130,15 +252,15 @@ void CellularAutomaton::evolve(const unsigned int minHitsPerNtuplet)
   //last iteration
   
   
-  for(int rootLayerId : theLayerGraph.theRootLayers)
+  for(int rootLayerId : theLayerGraph->theRootLayers)
     {
-      for(int rootLayerPair: theLayerGraph.theLayers[rootLayerId].theOuterLayerPairs)
+      for(int rootLayerPair: theLayerGraph->theLayers[rootLayerId].theOuterLayerPairs)
 	{
-	  auto foundCells = theLayerGraph.theLayerPairs[rootLayerPair].theFoundCells;
+	  auto foundCells = theLayerGraph->theLayerPairs[rootLayerPair].theFoundCells;
 	  for (auto i =foundCells[0]; i<foundCells[1]; ++i)
 	    {
 	      auto & cell =  allStatus[i];
-	      allCells[i].evolve(i,allStatus);
+	      allCells[i].evolve(i,theOuterNeighbors,allStatus);
 	      cell.updateState();
 	      if (cell.isRootCell(minHitsPerNtuplet - 2))
 		{
@@ -161,7 +283,7 @@ void CellularAutomaton::findNtuplets(
 	{
 	  tmpNtuplet.clear();
 	  tmpNtuplet.push_back(root_cell);
-	  allCells[root_cell].findNtuplets(allCells,foundNtuplets, tmpNtuplet, minHitsPerNtuplet);
+	  allCells[root_cell].findNtuplets(allCells,theOuterNeighbors,root_cell,foundNtuplets, tmpNtuplet, minHitsPerNtuplet);
 	}
 
 }
@@ -170,96 +292,44 @@ void CellularAutomaton::findNtuplets(
 void CellularAutomaton::findTriplets(const std::vector<const HitDoublets*>& hitDoublets,std::vector<CACell::CAntuplet>& foundTriplets, const TrackingRegion& region,
 		const float thetaCut, const float phiCut, const float hardPtCut)
 {
-        int tsize=0;
-        for ( auto hd :  hitDoublets) tsize+=hd->size();
-        allCells.reserve(tsize);
-
-        unsigned int cellId = 0;
 	float ptmin = region.ptMin();
 	float region_origin_x = region.origin().x();
 	float region_origin_y = region.origin().y();
 	float region_origin_radius = region.originRBound();
 
-	std::vector<bool> alreadyVisitedLayerPairs;
-	alreadyVisitedLayerPairs.resize(theLayerGraph.theLayerPairs.size());
-	for (auto visited : alreadyVisitedLayerPairs)
-	{
-		visited = false;
-	}
-	for (int rootVertex : theLayerGraph.theRootLayers)
-	{
-
-		std::queue<int> LayerPairsToVisit;
-
-		for (int LayerPair : theLayerGraph.theLayers[rootVertex].theOuterLayerPairs)
-		{
-			LayerPairsToVisit.push(LayerPair);
-
-		}
-
-		unsigned int numberOfLayerPairsToVisitAtThisDepth =
-				LayerPairsToVisit.size();
-
-		while (!LayerPairsToVisit.empty())
-		{
-			auto currentLayerPair = LayerPairsToVisit.front();
-			auto & currentLayerPairRef = theLayerGraph.theLayerPairs[currentLayerPair];
-			auto & currentInnerLayerRef = theLayerGraph.theLayers[currentLayerPairRef.theLayers[0]];
-			auto & currentOuterLayerRef = theLayerGraph.theLayers[currentLayerPairRef.theLayers[1]];
-			bool allInnerLayerPairsAlreadyVisited	{ true };
-
-			for (auto innerLayerPair : currentInnerLayerRef.theInnerLayerPairs)
-			{
-				allInnerLayerPairsAlreadyVisited &=
-						alreadyVisitedLayerPairs[innerLayerPair];
-			}
-
-			if (alreadyVisitedLayerPairs[currentLayerPair] == false
-					&& allInnerLayerPairsAlreadyVisited)
-			{
-
-				const HitDoublets* doubletLayerPairId =
-						hitDoublets[currentLayerPair];
-				auto numberOfDoublets = doubletLayerPairId->size();
-				currentLayerPairRef.theFoundCells[0] = cellId;
-				currentLayerPairRef.theFoundCells[1] = cellId+numberOfDoublets;
-				for (unsigned int i = 0; i < numberOfDoublets; ++i)
-				{
-				  allCells.emplace_back(doubletLayerPairId, i,
-							doubletLayerPairId->innerHitId(i),
-							doubletLayerPairId->outerHitId(i));
-				  
-										  
-				  currentOuterLayerRef.isOuterHitOfCell[doubletLayerPairId->outerHitId(i)].push_back(cellId);
-														     
-				  cellId++;
-
-				  auto & neigCells = currentInnerLayerRef.isOuterHitOfCell[doubletLayerPairId->innerHitId(i)];
-				  allCells.back().checkAlignmentAndPushTriplet(allCells,
-									       neigCells, foundTriplets, ptmin, region_origin_x,
-									       region_origin_y, region_origin_radius, thetaCut,
-									       phiCut, hardPtCut
-									       );
-				}
-				assert(cellId==currentLayerPairRef.theFoundCells[1]);
-
-
-				for (auto outerLayerPair : currentOuterLayerRef.theOuterLayerPairs)
-				{
-					LayerPairsToVisit.push(outerLayerPair);
-				}
-
-				alreadyVisitedLayerPairs[currentLayerPair] = true;
-			}
-			LayerPairsToVisit.pop();
-			numberOfLayerPairsToVisitAtThisDepth--;
-			if (numberOfLayerPairsToVisitAtThisDepth == 0)
+	createCells(hitDoublets);
+	indexOuterHits(hitDoublets);
+
+	auto & layerGraph = *theLayerGraph;
+	const auto numberOfLayerPairs = theLayerPairsInOrder.size();
+	theFoundTriplets.resize(numberOfLayerPairs);
+	tbb::this_task_arena::isolate([&] {
+		tbb::parallel_for(std::size_t(0), numberOfLayerPairs, [&](std::size_t ip) {
+			auto & triplets = theFoundTriplets[ip];
+			triplets.clear();
+			auto const & layerPairRef = layerGraph.theLayerPairs[theLayerPairsInOrder[ip]];
+			auto const & offsets = theOuterHitOffsets[layerPairRef.theLayers[0]];
+			auto const & cells = theOuterHitCells[layerPairRef.theLayers[0]];
+			const HitDoublets* doublets = hitDoublets[theLayerPairsInOrder[ip]];
+			for (auto cellId = layerPairRef.theFoundCells[0]; cellId < layerPairRef.theFoundCells[1]; ++cellId)
 			{
-				numberOfLayerPairsToVisitAtThisDepth = LayerPairsToVisit.size();
+				auto innerHit = doublets->innerHitId(cellId - layerPairRef.theFoundCells[0]);
+				allCells[cellId].checkAlignmentAndPushTriplet(allCells,
+									      cells.data() + offsets[innerHit], offsets[innerHit + 1] - offsets[innerHit],
+									      triplets, ptmin, region_origin_x,
+									      region_origin_y, region_origin_radius, thetaCut,
+									      phiCut, hardPtCut);
 			}
+		});
+	});
 
+	// keep the order of the sequential creation
+	for (std::size_t ip = 0; ip < numberOfLayerPairs; ++ip)
+	{
+		for (auto & triplet : theFoundTriplets[ip])
+		{
+			foundTriplets.emplace_back(std::move(triplet));
 		}
-
 	}
 
 }
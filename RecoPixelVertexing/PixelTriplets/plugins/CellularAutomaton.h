@@ -8,12 +8,15 @@
 class CellularAutomaton
 {
 public:
-  CellularAutomaton(CAGraph& graph)
-    : theLayerGraph(graph)
+  CellularAutomaton()
   {
     
   }
   
+  // to be called for each region: the cells and their connections are
+  // stored in flat index-based arrays whose capacity is kept across regions and events
+  void reset(CAGraph& graph);
+
   std::vector<CACell> & getAllCells() { return allCells;}
   
   void createAndConnectCells(const std::vector<const HitDoublets *>&,
@@ -25,13 +28,25 @@ public:
 		    const float thetaCut, const float phiCut, const float hardPtCut);
   
 private:
-  CAGraph & theLayerGraph;
+  void createCells(const std::vector<const HitDoublets *>&);
+  void indexOuterHits(const std::vector<const HitDoublets *>&);
+
+  CAGraph * theLayerGraph = nullptr;
 
   std::vector<CACell> allCells;
   std::vector<CACellStatus> allStatus;
+  CACellNeighbors theOuterNeighbors;
+
+  // layer pairs in the order their cells were created, inner pairs come first
+  std::vector<int> theLayerPairsInOrder;
+  // for each layer, the cells ending on each of its hits (compressed sparse row)
+  std::vector<std::vector<unsigned int> > theOuterHitOffsets;
+  std::vector<std::vector<unsigned int> > theOuterHitCells;
+  // connections found for each layer pair, filled concurrently
+  std::vector<std::vector<CACell::CAEdge> > theFoundEdges;
+  std::vector<std::vector<CACell::CAntuplet> > theFoundTriplets;
 
   std::vector<unsigned int> theRootCells;
-  std::vector<std::vector<CACell*> > theNtuplets;
   
 };
 
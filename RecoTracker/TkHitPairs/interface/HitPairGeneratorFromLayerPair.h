@@ -54,6 +54,17 @@ public:
 						      const unsigned int theMaxElement,
 						      HitDoublets & result);
 
+  /// select among candidate doublets, found for a larger region sharing the
+  /// same hit maps, those compatible with the given region
+  static void filterDoublets(
+						      const TrackingRegion& region,
+						      const DetLayer & innerHitDetLayer,
+						      const DetLayer & outerHitDetLayer,
+						      const HitDoublets & candidates,
+						      const edm::EventSetup& iSetup,
+						      const unsigned int theMaxElement,
+						      HitDoublets & result);
+
   
   
   Layer innerLayer(const Layers& layers) const { return layers[theInnerLayer]; }
@@ -4,6 +4,8 @@
 #include "RecoTracker/TkHitPairs/interface/LayerHitMapCache.h"
 #include "TrackingTools/TransientTrackingRecHit/interface/SeedingLayerSetsHits.h"
 
+#include <memory>
+
 namespace ihd {
   /**
    * Class to hold TrackingRegion and begin+end indices to a vector of
@@ -215,6 +217,18 @@ public:
     return RegionFiller(this);
   }
 
+  /**
+   * Takes ownership of a region merging several overlapping regions,
+   * and returns its LayerHitMapCache. The doublets of the merged
+   * regions point to the hit maps of this cache, so both need to live
+   * as long as this object.
+   */
+  LayerHitMapCache& addSharedRegion(std::unique_ptr<TrackingRegion> region) {
+    sharedRegions_.emplace_back(std::move(region));
+    sharedCaches_.emplace_back(std::make_unique<LayerHitMapCache>());
+    return *sharedCaches_.back();
+  }
+
   const SeedingLayerSetsHits& seedingLayerHits() const { return *seedingLayers_; }
   bool empty() const { return regions_.empty(); }
   size_t regionSize() const { return regions_.size(); }
@@ -236,6 +250,9 @@ private:
 
   std::vector<RegionIndex> regions_;             /// Container of regions, each element has indices pointing to layerPairs_
   std::vector<LayerPairHitDoublets> layerPairs_; /// Container of layer pairs and doublets for all regions
+
+  std::vector<std::unique_ptr<TrackingRegion> > sharedRegions_;  /// Merged regions whose hit maps are shared by several regions
+  std::vector<std::unique_ptr<LayerHitMapCache> > sharedCaches_; /// Hit maps of the merged regions
 };
 
 #endif
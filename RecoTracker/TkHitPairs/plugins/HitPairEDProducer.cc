@@ -9,6 +9,7 @@
 #include "FWCore/Utilities/interface/RunningAverage.h"
 
 #include "RecoTracker/TkTrackingRegions/interface/TrackingRegion.h"
+#include "RecoTracker/TkTrackingRegions/interface/RectangularEtaPhiTrackingRegion.h"
 #include "DataFormats/Common/interface/OwnVector.h"
 #include "TrackingTools/TransientTrackingRecHit/interface/SeedingLayerSetsHits.h"
 #include "RecoTracker/TkTrackingRegions/interface/TrackingRegionsSeedingLayerSets.h"
@@ -17,6 +18,8 @@
 #include "RecoTracker/TkHitPairs/interface/IntermediateHitDoublets.h"
 #include "RecoTracker/TkHitPairs/interface/RegionsSeedingHitSets.h"
 
+#include <algorithm>
+
 namespace { class ImplBase; }
 
 class HitPairEDProducer: public edm::stream::EDProducer<> {
@@ -47,12 +50,14 @@ namespace {
   protected:
     edm::RunningAverage localRA_;
     const unsigned int maxElement_;
+    const bool mergeOverlappingRegions_;
 
     HitPairGeneratorFromLayerPair generator_;
     std::vector<unsigned> layerPairBegins_;
   };
   ImplBase::ImplBase(const edm::ParameterSet& iConfig):
     maxElement_(iConfig.getParameter<unsigned int>("maxElement")),
+    mergeOverlappingRegions_(iConfig.getParameter<bool>("mergeOverlappingRegions")),
     generator_(0, 1, nullptr, maxElement_), // these indices are dummy, TODO: cleanup HitPairGeneratorFromLayerPair
     layerPairBegins_(iConfig.getParameter<std::vector<unsigned> >("layerPairs"))
   {
@@ -91,12 +96,40 @@ namespace {
       seedingHitSetsProducer.reserve(regionsLayers.regionsSize());
       intermediateHitDoubletsProducer.reserve(regionsLayers.regionsSize());
 
+      if(mergeOverlappingRegions_) {
+        groupRegions(regionsLayers);
+      }
+
+      size_t iRegion = 0;
       for(const auto& regionLayers: regionsLayers) {
         const TrackingRegion& region = regionLayers.region();
         auto hitCachePtr_filler_shs = seedingHitSetsProducer.beginRegion(&region, nullptr);
         auto hitCachePtr_filler_ihd = intermediateHitDoubletsProducer.beginRegion(&region, std::get<0>(hitCachePtr_filler_shs));
         auto hitCachePtr = std::get<0>(hitCachePtr_filler_ihd);
 
+        const int group = mergeOverlappingRegions_ ? groupOfRegion_[iRegion] : -1;
+        ++iRegion;
+        if(group >= 0 && groupSize_[group] > 1) {
+          const auto& layerPairs = regionLayers.layerPairs();
+          const auto& candidates = groupDoublets(group, layerPairs, iSetup, intermediateHitDoubletsProducer);
+          hitCachePtr->extend(*groupCache_[group]);
+
+          // keep the doublets of the merged region compatible with this region
+          for(size_t i=0; i<layerPairs.size(); ++i) {
+            const auto& layerSet = layerPairs[i];
+            HitDoublets doublets(candidates[i].innerLayer(), candidates[i].outerLayer());
+            if(!candidates[i].empty()) {
+              HitPairGeneratorFromLayerPair::filterDoublets(region, *layerSet[0].detLayer(), *layerSet[1].detLayer(),
+                                                            candidates[i], iSetup, maxElement_, doublets);
+            }
+            LogTrace("HitPairEDProducer") << " selected " << doublets.size() << " of " << candidates[i].size() << " doublets of merged region " << group << " for layers " << layerSet[0].index() << "," << layerSet[1].index();
+            if(doublets.empty()) continue;
+            seedingHitSetsProducer.fill(std::get<1>(hitCachePtr_filler_shs), doublets);
+            intermediateHitDoubletsProducer.fill(std::get<1>(hitCachePtr_filler_ihd), layerSet, std::move(doublets));
+          }
+          continue;
+        }
+
         for(SeedingLayerSetsHits::SeedingLayerSet layerSet: regionLayers.layerPairs()) {
           auto doublets = generator_.doublets(region, iEvent, iSetup, layerSet, *hitCachePtr);
           LogTrace("HitPairEDProducer") << " created " << doublets.size() << " doublets for layers " << layerSet[0].index() << "," << layerSet[1].index();
@@ -111,7 +144,73 @@ namespace {
     }
 
   private:
+    // Groups the overlapping RectangularEtaPhiTrackingRegions, each group
+    // being described by the smallest region containing all its members
+    template <typename T_EventTmp>
+    void groupRegions(const T_EventTmp& regionsLayers) {
+      mergedRegions_.clear();
+      groupSize_.clear();
+      groupOfRegion_.clear();
+      for(const auto& regionLayers: regionsLayers) {
+        const auto *rect = dynamic_cast<const RectangularEtaPhiTrackingRegion *>(&(regionLayers.region()));
+        if(rect == nullptr) {
+          groupOfRegion_.push_back(-1);
+          continue;
+        }
+        auto found = std::find_if(mergedRegions_.begin(), mergedRegions_.end(), [rect](const auto& merged) {
+            return merged->isMergeableWith(*rect);
+          });
+        if(found != mergedRegions_.end()) {
+          *found = std::make_unique<RectangularEtaPhiTrackingRegion>((*found)->mergedWith(*rect));
+          groupOfRegion_.push_back(found - mergedRegions_.begin());
+          ++groupSize_[groupOfRegion_.back()];
+        }
+        else {
+          groupOfRegion_.push_back(mergedRegions_.size());
+          mergedRegions_.push_back(std::make_unique<RectangularEtaPhiTrackingRegion>(*rect));
+          groupSize_.push_back(1);
+        }
+      }
+      groupCache_.assign(mergedRegions_.size(), nullptr);
+      groupDoublets_.clear();
+      groupDoublets_.resize(mergedRegions_.size());
+    }
+
+    // Doublets of the merged region of a group, created once for all its members
+    template <typename T_LayerPairs>
+    const std::vector<HitDoublets>& groupDoublets(int group, const T_LayerPairs& layerPairs, const edm::EventSetup& iSetup,
+                                                  T_IntermediateHitDoublets& intermediateHitDoubletsProducer) {
+      auto& doublets = groupDoublets_[group];
+      if(groupCache_[group] != nullptr)
+        return doublets;
+
+      // the merged region and its hit maps must live as long as the doublets
+      const TrackingRegion& merged = *mergedRegions_[group];
+      groupCache_[group] = intermediateHitDoubletsProducer.addSharedRegion(std::move(mergedRegions_[group]));
+      auto& hitCache = *groupCache_[group];
+
+      doublets.reserve(layerPairs.size());
+      for(const auto& layerSet: layerPairs) {
+        const RecHitsSortedInPhi& innerHitsMap = hitCache(layerSet[0], merged, iSetup);
+        const RecHitsSortedInPhi& outerHitsMap = hitCache(layerSet[1], merged, iSetup);
+        doublets.emplace_back(innerHitsMap, outerHitsMap);
+        if(innerHitsMap.empty() || outerHitsMap.empty()) continue;
+        // no limit here, maxElement applies to the doublets of each region
+        HitPairGeneratorFromLayerPair::doublets(merged, *layerSet[0].detLayer(), *layerSet[1].detLayer(),
+                                                innerHitsMap, outerHitsMap, iSetup, 0, doublets.back());
+        LogTrace("HitPairEDProducer") << " created " << doublets.back().size() << " doublets of merged region " << group << " for layers " << layerSet[0].index() << "," << layerSet[1].index();
+      }
+      return doublets;
+    }
+
     T_RegionLayers regionsLayers_;
+
+    // per-event workspace of mergeOverlappingRegions
+    std::vector<std::unique_ptr<RectangularEtaPhiTrackingRegion> > mergedRegions_;
+    std::vector<unsigned int> groupSize_;
+    std::vector<int> groupOfRegion_;
+    std::vector<LayerHitMapCache *> groupCache_;
+    std::vector<std::vector<HitDoublets> > groupDoublets_;
   };
 
   /////
@@ -131,6 +230,8 @@ namespace {
     void fill(int, const HitDoublets&) {}
     void fill(int, const SeedingLayerSetsHits::SeedingLayerSet&, HitDoublets&&) {}
 
+    LayerHitMapCache *addSharedRegion(std::unique_ptr<TrackingRegion>) { return nullptr; }
+
     void put(edm::Event&) {}
     void putEmpty(edm::Event&) {}
   };
@@ -204,6 +305,10 @@ namespace {
       filler.addDoublets(layerSet, std::move(doublets));
     }
 
+    LayerHitMapCache *addSharedRegion(std::unique_ptr<TrackingRegion> region) {
+      return &(intermediateHitDoublets_->addSharedRegion(std::move(region)));
+    }
+
     void put(edm::Event& iEvent) {
       intermediateHitDoublets_->shrink_to_fit();
       putEmpty(iEvent);
@@ -442,6 +547,13 @@ HitPairEDProducer::HitPairEDProducer(const edm::ParameterSet& iConfig) {
   else
     throw cms::Exception("Configuration") << "HitPairEDProducer requires either produceIntermediateHitDoublets or produceSeedingHitSets to be True. If neither are needed, just remove this module from your sequence/path as it doesn't do anything useful";
 
+  if(iConfig.getParameter<bool>("mergeOverlappingRegions")) {
+    // the doublets of the merged regions point to hits owned by the merged
+    // regions, which are kept alive only by the IntermediateHitDoublets
+    if(useRegionLayers || produceSeedingHitSets || !produceIntermediateHitDoublets)
+      throw cms::Exception("Configuration") << "HitPairEDProducer with mergeOverlappingRegions requires produceIntermediateHitDoublets to be True, produceSeedingHitSets to be False, and trackingRegionsSeedingLayers to be empty";
+  }
+
   auto clusterCheckTag = iConfig.getParameter<edm::InputTag>("clusterCheck");
   if(clusterCheckTag.label() != "")
     clusterCheckToken_ = consumes<bool>(clusterCheckTag);
@@ -459,6 +571,7 @@ void HitPairEDProducer::fillDescriptions(edm::ConfigurationDescriptions& descrip
   desc.add<bool>("produceSeedingHitSets", false);
   desc.add<bool>("produceIntermediateHitDoublets", false);
   desc.add<unsigned int>("maxElement", 1000000);
+  desc.add<bool>("mergeOverlappingRegions", false)->setComment("Create the doublets once for each group of overlapping RectangularEtaPhiTrackingRegions (with the same origin), and select for each region the doublets compatible with it. Requires produceIntermediateHitDoublets only.");
   desc.add<std::vector<unsigned> >("layerPairs", std::vector<unsigned>{0})->setComment("Indices to the pairs of consecutive layers, i.e. 0 means (0,1), 1 (1,2) etc.");
 
   descriptions.add("hitPairEDProducerDefault", desc);
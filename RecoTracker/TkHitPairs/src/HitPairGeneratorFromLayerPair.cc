@@ -180,4 +180,78 @@ void HitPairGeneratorFromLayerPair::doublets(const TrackingRegion& region,
 
 }
 
+void HitPairGeneratorFromLayerPair::filterDoublets(const TrackingRegion& region,
+						   const DetLayer & innerHitDetLayer,
+						   const DetLayer & outerHitDetLayer,
+						   const HitDoublets & candidates,
+						   const edm::EventSetup& iSetup,
+						   const unsigned int theMaxElement,
+						   HitDoublets & result){
+
+  const RecHitsSortedInPhi & innerHitsMap = candidates.innerLayer();
+  const RecHitsSortedInPhi & outerHitsMap = candidates.outerLayer();
+  InnerDeltaPhi deltaPhi(outerHitDetLayer, innerHitDetLayer, region, iSetup);
+
+  constexpr float nSigmaPhi = 3.f;
+  Kernels<HitZCheck,HitRCheck,HitEtaCheck> kernels;
+
+  // the candidates are sorted by outer hit: apply the same selection as
+  // doublets() above, evaluating the region constraints once per outer hit
+  const int nc = candidates.size();
+  int ic = 0;
+  while (ic != nc) {
+    const int io = candidates.outerHitId(ic);
+    int ec = ic;
+    while (ec != nc && candidates.outerHitId(ec) == io) ++ec;
+    const int b = ic;
+    ic = ec;
+
+    if (!deltaPhi.prefilter(outerHitsMap.x[io],outerHitsMap.y[io])) continue;
+    PixelRecoRange<float> phiRange = deltaPhi(outerHitsMap.x[io],
+					      outerHitsMap.y[io],
+					      outerHitsMap.z[io],
+					      nSigmaPhi*outerHitsMap.drphi[io]
+					      );
+    if (phiRange.empty()) continue;
+
+    const HitRZCompatibility *checkRZ = region.checkRZ(&innerHitDetLayer, outerHitsMap.theHits[io].hit(), iSetup, &outerHitDetLayer,
+						       outerHitsMap.rv(io),outerHitsMap.z[io],
+						       outerHitsMap.isBarrel ? outerHitsMap.du[io] :  outerHitsMap.dv[io],
+						       outerHitsMap.isBarrel ? outerHitsMap.dv[io] :  outerHitsMap.du[io]
+						       );
+    if(!checkRZ) continue;
+
+    auto innerRange = innerHitsMap.doubleRange(phiRange.min(), phiRange.max());
+    for (int c = b; c != ec; ++c) {
+      const int ii = candidates.innerHitId(c);
+      if (!((ii >= innerRange[0] && ii < innerRange[1]) || (ii >= innerRange[2] && ii < innerRange[3]))) continue;
+      bool ok[1] = {false};
+      switch (checkRZ->algo()) {
+	case (HitRZCompatibility::zAlgo) :
+	  std::get<0>(kernels).set(checkRZ);
+	  std::get<0>(kernels)(ii,ii+1,innerHitsMap, ok);
+	  break;
+	case (HitRZCompatibility::rAlgo) :
+	  std::get<1>(kernels).set(checkRZ);
+	  std::get<1>(kernels)(ii,ii+1,innerHitsMap, ok);
+	  break;
+	case (HitRZCompatibility::etaAlgo) :
+	  std::get<2>(kernels).set(checkRZ);
+	  std::get<2>(kernels)(ii,ii+1,innerHitsMap, ok);
+	  break;
+      }
+      if (!ok[0]) continue;
+      if (theMaxElement!=0 && result.size() >= theMaxElement){
+	result.clear();
+	edm::LogError("TooManyPairs")<<"number of pairs exceed maximum, no pairs produced";
+	delete checkRZ;
+	return;
+      }
+      result.add(ii,io);
+    }
+    delete checkRZ;
+  }
+  LogDebug("HitPairGeneratorFromLayerPair")<<" number of pairs selected from "<<candidates.size()<<" candidates: "<<result.size();
+  result.shrink_to_fit();
 
+}
@@ -55,6 +55,7 @@ public:
     theMeanLambda(rh.theMeanLambda),
     theMeasurementTrackerUsage(rh.theMeasurementTrackerUsage),
     thePrecise(rh.thePrecise),
+    theUseMS(rh.theUseMS),
     theUseEtaPhi(rh.theUseEtaPhi),
     theMeasurementTracker(rh.theMeasurementTracker) {}
   
@@ -157,6 +158,14 @@ public:
   /// is precise error calculation switched on 
   bool  isPrecise() const { return thePrecise; }
 
+  /// true if the two regions have the same origin and hit selection settings
+  /// and overlapping eta-phi windows, i.e. if they can be replaced by mergedWith()
+  bool isMergeableWith(const RectangularEtaPhiTrackingRegion& other) const;
+
+  /// smallest region containing both this region and the other one:
+  /// union of the eta-phi windows and of the pt ranges, largest origin bounds
+  RectangularEtaPhiTrackingRegion mergedWith(const RectangularEtaPhiTrackingRegion& other) const;
+
   TrackingRegion::Hits hits(
       const edm::EventSetup& es,
       const SeedingLayerSetsHits::SeedingLayer& layer) const override;
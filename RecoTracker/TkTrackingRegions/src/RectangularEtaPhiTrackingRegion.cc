@@ -32,6 +32,7 @@
 #include "DataFormats/GeometrySurface/interface/BoundPlane.h"
 #include "TrackingTools/TransientTrackingRecHit/interface/TransientTrackingRecHit.h"
 #include "TrackingTools/KalmanUpdators/interface/EtaPhiMeasurementEstimator.h"
+#include "DataFormats/Math/interface/deltaPhi.h"
 
 
 #include<iostream>
@@ -421,6 +422,50 @@ TrackingRegion::Hits RectangularEtaPhiTrackingRegion::hits(
   return result;
 }
 
+bool RectangularEtaPhiTrackingRegion::isMergeableWith(const RectangularEtaPhiTrackingRegion& other) const {
+  // the hits are selected and sorted with respect to the origin
+  if (origin().x() != other.origin().x() ||
+      origin().y() != other.origin().y() ||
+      origin().z() != other.origin().z()) return false;
+  if (theMeasurementTrackerUsage != other.theMeasurementTrackerUsage ||
+      theMeasurementTracker != other.theMeasurementTracker ||
+      thePrecise != other.thePrecise ||
+      theUseMS != other.theUseMS ||
+      theUseEtaPhi != other.theUseEtaPhi) return false;
+
+  if (theEtaRange.max() < other.theEtaRange.min() ||
+      other.theEtaRange.max() < theEtaRange.min()) return false;
+
+  // phi window of the other region with respect to the direction of this one
+  float dphi = reco::deltaPhi(other.phiDirection(), phiDirection());
+  return (dphi + other.thePhiMargin.right() >= -thePhiMargin.left()) &&
+         (dphi - other.thePhiMargin.left() <= thePhiMargin.right());
+}
+
+RectangularEtaPhiTrackingRegion RectangularEtaPhiTrackingRegion::mergedWith(const RectangularEtaPhiTrackingRegion& other) const {
+  float dphi = reco::deltaPhi(other.phiDirection(), phiDirection());
+  float phiLeft = std::max(thePhiMargin.left(), other.thePhiMargin.left() - dphi);
+  float phiRight = std::max(thePhiMargin.right(), other.thePhiMargin.right() + dphi);
+  float phi = phiDirection() + 0.5f*(phiRight - phiLeft);
+  float halfPhi = std::min(0.5f*(phiLeft + phiRight), float(M_PI));
+
+  float etaMin = std::min(theEtaRange.min(), other.theEtaRange.min());
+  float etaMax = std::max(theEtaRange.max(), other.theEtaRange.max());
+  float eta = 0.5f*(etaMin + etaMax);
+  float halfEta = 0.5f*(etaMax - etaMin);
+
+  Range mergedInvPtRange(std::min(invPtRange().min(), other.invPtRange().min()),
+                         std::max(invPtRange().max(), other.invPtRange().max()));
+
+  GlobalVector dir(std::cos(phi), std::sin(phi), std::sinh(eta));
+  return RectangularEtaPhiTrackingRegion(dir, origin(), mergedInvPtRange,
+                                         std::max(originRBound(), other.originRBound()),
+                                         std::max(originZBound(), other.originZBound()),
+                                         Margin(halfEta, halfEta), Margin(halfPhi, halfPhi),
+                                         theMeasurementTrackerUsage, thePrecise,
+                                         theMeasurementTracker, theUseEtaPhi, theUseMS);
+}
+
 std::string RectangularEtaPhiTrackingRegion::print() const {
   std::ostringstream str;
   str << TrackingRegionBase::print() 
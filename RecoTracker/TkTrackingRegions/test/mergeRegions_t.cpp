@@ -0,0 +1,56 @@
+#include "RecoTracker/TkTrackingRegions/interface/RectangularEtaPhiTrackingRegion.h"
+
+#include <cmath>
+#include <iostream>
+#include <memory>
+
+namespace {
+  typedef RectangularEtaPhiTrackingRegion::Margin Margin;
+
+  RectangularEtaPhiTrackingRegion makeRegion(float phi, float eta, float ptMin, bool useMS) {
+    return RectangularEtaPhiTrackingRegion(GlobalVector(std::cos(phi), std::sin(phi), std::sinh(eta)),
+                                           GlobalPoint(0, 0, 0),
+                                           TrackingRegion::Range(-1/ptMin, 1/ptMin),
+                                           0.2, 15.9,
+                                           Margin(0.3, 0.3), Margin(0.3, 0.3),
+                                           RectangularEtaPhiTrackingRegion::UseMeasurementTracker::kNever,
+                                           true, nullptr, false, useMS);
+  }
+
+  int check(bool ok, const char* what) {
+    if(!ok) std::cout << "FAILED: " << what << std::endl;
+    return ok ? 0 : 1;
+  }
+}
+
+int main(void) {
+  int failures = 0;
+
+  auto const msA = makeRegion(0.1, 0.5, 1.0, true);
+  auto const msB = makeRegion(0.3, 0.6, 2.0, true);
+  auto const noMsB = makeRegion(0.3, 0.6, 2.0, false);
+  auto const far = makeRegion(2.0, 0.5, 1.0, true);
+
+  // copies (as used to seed the merged groups) keep all hit selection settings
+  RectangularEtaPhiTrackingRegion const copyA(msA);
+  std::unique_ptr<RectangularEtaPhiTrackingRegion> cloneA(msA.clone());
+  failures += check(copyA.isMergeableWith(msA), "copy constructor keeps useMS");
+  failures += check(cloneA->isMergeableWith(msA), "clone keeps useMS");
+
+  failures += check(msA.isMergeableWith(msB), "overlapping useMS regions merge");
+  failures += check(!msA.isMergeableWith(noMsB), "useMS and no-useMS regions do not merge");
+  failures += check(!copyA.isMergeableWith(noMsB), "copy of a useMS region does not merge with no-useMS");
+  failures += check(!msA.isMergeableWith(far), "disjoint phi windows do not merge");
+
+  auto const merged = copyA.mergedWith(msB);
+  failures += check(merged.isMergeableWith(msA), "merged region keeps useMS");
+  failures += check(!merged.isMergeableWith(noMsB), "merged region does not pick up no-useMS regions");
+  failures += check(merged.etaRange().min() <= msA.etaRange().min() &&
+                    merged.etaRange().max() >= msB.etaRange().max(), "merged eta range covers both");
+  failures += check(merged.invPtRange().min() <= msA.invPtRange().min() &&
+                    merged.invPtRange().max() >= msA.invPtRange().max(), "merged pt range covers both");
+  failures += check(merged.originRBound() >= msA.originRBound() &&
+                    merged.originZBound() >= msA.originZBound(), "merged origin bounds cover both");
+
+  return failures;
+}
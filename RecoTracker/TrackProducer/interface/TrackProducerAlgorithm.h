@@ -60,7 +60,8 @@ public:
     originalAlgo_(reco::TrackBase::undefAlgorithm),
     stopReason_(0),
     reMatchSplitHits_(false),
-    usePropagatorForPCA_(false)
+    usePropagatorForPCA_(false),
+    fitBlockSize_(0)
       {
         geometricInnerState_ = (conf.exists("GeometricInnerState") ?
 	  conf.getParameter<bool>( "GeometricInnerState" ) : true);
@@ -68,6 +69,8 @@ public:
 	  reMatchSplitHits_=conf.getParameter<bool>("reMatchSplitHits");
         if (conf.exists("usePropagatorForPCA"))
           usePropagatorForPCA_ = conf.getParameter<bool>("usePropagatorForPCA");
+        if (conf.exists("fitBlockSize"))
+          fitBlockSize_ = conf.getParameter<unsigned int>("fitBlockSize");
       }
 
   /// Destructor
@@ -138,6 +141,18 @@ public:
 		  int qualityMask=0,
 		  signed char nLoops=0);
 
+  /// Construct Tracks to be put in the event from an already fitted Trajectory
+  bool buildTrack(Trajectory &&,
+		  const Propagator *,
+		  AlgoProductCollection& ,
+		  const TrajectoryStateOnSurface& ,
+		  const TrajectorySeed&,
+		  float,
+		  const reco::BeamSpot&,
+		  SeedRef seedRef = SeedRef(),
+		  int qualityMask=0,
+		  signed char nLoops=0);
+
 
  private:
   reco::TrackBase::TrackAlgorithm algo_;
@@ -148,6 +163,18 @@ public:
   bool reMatchSplitHits_;
   bool geometricInnerState_;
   bool usePropagatorForPCA_;
+  // if >0 the TrackCandidates are fitted concurrently, in blocks of
+  // fitBlockSize_ candidates sharing one fitter
+  unsigned int fitBlockSize_;
+
+  void fitCandidatesInParallel(const TrackingGeometry *,
+			       const MagneticField *,
+			       const TrackCandidateCollection&,
+			       const TrajectoryFitter *,
+			       const Propagator *,
+			       const TransientTrackingRecHitBuilder*,
+			       const reco::BeamSpot&,
+			       AlgoProductCollection &);
 
   TrajectoryStateOnSurface getInitialState(const T * theT,
 					   TransientTrackingRecHit::RecHitContainer& hits,
@@ -185,4 +212,28 @@ TrackProducerAlgorithm<reco::GsfTrack>::buildTrack(const TrajectoryFitter *,
 						   int qualityMask,
 						   signed char nLoops);
 
+template <> bool
+TrackProducerAlgorithm<reco::Track>::buildTrack(Trajectory &&,
+						const Propagator *,
+						AlgoProductCollection& ,
+						const TrajectoryStateOnSurface& ,
+						const TrajectorySeed&,
+						float,
+						const reco::BeamSpot&,
+						SeedRef seedRef,
+						int qualityMask,
+						signed char nLoops);
+
+template <> bool
+TrackProducerAlgorithm<reco::GsfTrack>::buildTrack(Trajectory &&,
+						   const Propagator *,
+						   AlgoProductCollection& ,
+						   const TrajectoryStateOnSurface& ,
+						   const TrajectorySeed&,
+						   float,
+						   const reco::BeamSpot&,
+						   SeedRef seedRef,
+						   int qualityMask,
+						   signed char nLoops);
+
 #endif
@@ -20,6 +20,10 @@ TrackProducer = cms.EDProducer("TrackProducer",
     # true for cosmics/beam halo, false for collision tracks (needed by loopers)
     GeometricInnerState = cms.bool(False),
 
+    # if >0 the candidates are fitted concurrently in blocks of this size,
+    # the tracks are identical to the sequential fit
+    fitBlockSize = cms.uint32(0),
+
     ### These are paremeters related to the filling of the Secondary hit-patterns                               
     #set to "", the secondary hit pattern will not be filled (backward compatible with DetLayer=0)    
     NavigationSchool = cms.string('SimpleNavigationSchool'),          
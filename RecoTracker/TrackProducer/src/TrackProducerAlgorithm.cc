@@ -92,18 +92,31 @@ TrackProducerAlgorithm<reco::Track>::buildTrack (const TrajectoryFitter * theFit
 						 SeedRef seedRef,
 						 int qualityMask,signed char nLoops)
 {
-  //variable declarations
-
-  PropagationDirection seedDir = seed.direction();
-      
   //perform the fit: the result's size is 1 if it succeded, 0 if fails
   Trajectory && trajTmp = theFitter->fitOne(seed, hits, theTSOS,(nLoops>0) ? TrajectoryFitter::looper : TrajectoryFitter::standard);
   if unlikely(!trajTmp.isValid()) {
      DPRINT("TrackFitters") << "fit failed " << algo_ << ": " <<  hits.size() <<'|' << int(nLoops) << ' ' << std::endl; 
      return false;
   }
-  
-  
+
+  return buildTrack(std::move(trajTmp), thePropagator, algoResults, theTSOS, seed, ndof, bs, seedRef, qualityMask, nLoops);
+}
+
+template <> bool
+TrackProducerAlgorithm<reco::Track>::buildTrack (Trajectory && trajTmp,
+						 const Propagator * thePropagator,
+						 AlgoProductCollection& algoResults,
+						 const TrajectoryStateOnSurface& theTSOS,
+						 const TrajectorySeed& seed,
+						 float ndof,
+						 const reco::BeamSpot& bs,
+						 SeedRef seedRef,
+						 int qualityMask,signed char nLoops)
+{
+  //variable declarations
+
+  PropagationDirection seedDir = seed.direction();
+
   auto theTraj = new Trajectory(std::move(trajTmp));
   theTraj->setSeedRef(seedRef);
   
@@ -154,7 +167,7 @@ for (auto const & tm : theTraj->measurements()) {
  }
 
    std::ostringstream ss;
-   ss << algo_ << ": " <<  hits.size() <<'|' <<theTraj->measurements().size()<<'|' << int(nLoops) << ' ';   for (auto c:chit) ss << c <<'/'; ss << std::endl;
+   ss << algo_ << ": " <<theTraj->measurements().size()<<'|' << int(nLoops) << ' ';   for (auto c:chit) ss << c <<'/'; ss << std::endl;
    DPRINT("TrackProducer") << ss.str();
 
 #endif
@@ -244,13 +257,26 @@ TrackProducerAlgorithm<reco::GsfTrack>::buildTrack (const TrajectoryFitter * the
 						    SeedRef seedRef,
 						    int qualityMask,signed char nLoops)
 {
-
-  PropagationDirection seedDir = seed.direction();
-  
   Trajectory && trajTmp = theFitter->fitOne(seed, hits, theTSOS,(nLoops>0) ? TrajectoryFitter::looper: TrajectoryFitter::standard);
   if unlikely(!trajTmp.isValid()) return false;
-  
-  
+
+  return buildTrack(std::move(trajTmp), thePropagator, algoResults, theTSOS, seed, ndof, bs, seedRef, qualityMask, nLoops);
+}
+
+template <> bool
+TrackProducerAlgorithm<reco::GsfTrack>::buildTrack (Trajectory && trajTmp,
+						    const Propagator * thePropagator,
+						    AlgoProductCollection& algoResults,
+						    const TrajectoryStateOnSurface& theTSOS,
+						    const TrajectorySeed& seed,
+						    float ndof,
+						    const reco::BeamSpot& bs,
+						    SeedRef seedRef,
+						    int qualityMask,signed char nLoops)
+{
+
+  PropagationDirection seedDir = seed.direction();
+
   auto theTraj = new Trajectory( std::move(trajTmp) );
   theTraj->setSeedRef(seedRef);
 
@@ -0,0 +1,75 @@
+// -*- C++ -*-
+//
+// Package:    TrackProducer
+// Class:      TrackCollectionComparator
+//
+/**\class TrackCollectionComparator TrackCollectionComparator.cc RecoTracker/TrackProducer/test/TrackCollectionComparator.cc
+
+ Description: checks that two track collections are identical
+
+ Implementation:
+     Compares the collections track by track (number of tracks, hits,
+     chi2, ndof, parameters and covariance) and throws on the first
+     difference. Used to check that the concurrent block fit
+     (fitBlockSize>0) gives the same tracks as the sequential one.
+*/
+
+#include "FWCore/Framework/interface/Frameworkfwd.h"
+#include "FWCore/Framework/interface/stream/EDAnalyzer.h"
+
+#include "FWCore/Framework/interface/Event.h"
+#include "FWCore/Framework/interface/EventSetup.h"
+#include "FWCore/Framework/interface/MakerMacros.h"
+
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
+#include "FWCore/Utilities/interface/Exception.h"
+
+#include "DataFormats/TrackReco/interface/Track.h"
+#include "DataFormats/TrackReco/interface/TrackFwd.h"
+
+class TrackCollectionComparator : public edm::stream::EDAnalyzer<> {
+public:
+  explicit TrackCollectionComparator(const edm::ParameterSet&);
+
+private:
+  void analyze(const edm::Event&, const edm::EventSetup&) override;
+
+  edm::EDGetTokenT<reco::TrackCollection> referenceToken_;
+  edm::EDGetTokenT<reco::TrackCollection> tracksToken_;
+};
+
+TrackCollectionComparator::TrackCollectionComparator(const edm::ParameterSet& iConfig) :
+  referenceToken_(consumes<reco::TrackCollection>(iConfig.getParameter<edm::InputTag>("reference"))),
+  tracksToken_(consumes<reco::TrackCollection>(iConfig.getParameter<edm::InputTag>("tracks"))) {}
+
+void TrackCollectionComparator::analyze(const edm::Event& iEvent, const edm::EventSetup&)
+{
+  edm::Handle<reco::TrackCollection> reference;
+  iEvent.getByToken(referenceToken_, reference);
+  edm::Handle<reco::TrackCollection> tracks;
+  iEvent.getByToken(tracksToken_, tracks);
+
+  if (reference->size() != tracks->size())
+    throw cms::Exception("TrackMismatch") << "event " << iEvent.id() << ": " << reference->size()
+                                          << " reference tracks, " << tracks->size() << " tracks";
+
+  for (unsigned int i = 0; i != tracks->size(); ++i) {
+    const reco::Track& ref = (*reference)[i];
+    const reco::Track& trk = (*tracks)[i];
+    bool same = ref.recHitsSize() == trk.recHitsSize() &&
+                ref.chi2() == trk.chi2() &&
+                ref.ndof() == trk.ndof() &&
+                ref.parameters() == trk.parameters();
+    for (unsigned int j = 0; same && j != reco::TrackBase::dimension; ++j)
+      for (unsigned int k = 0; same && k <= j; ++k)
+        same = ref.covariance(j, k) == trk.covariance(j, k);
+    if (!same)
+      throw cms::Exception("TrackMismatch") << "event " << iEvent.id() << ": track " << i << " differs"
+                                            << "\n  reference: pt " << ref.pt() << " chi2 " << ref.chi2()
+                                            << " ndof " << ref.ndof() << " hits " << ref.recHitsSize()
+                                            << "\n  track:     pt " << trk.pt() << " chi2 " << trk.chi2()
+                                            << " ndof " << trk.ndof() << " hits " << trk.recHitsSize();
+  }
+}
+
+DEFINE_FWK_MODULE(TrackCollectionComparator);
@@ -0,0 +1,51 @@
+# Runs the tracking twice on the same candidates, with the sequential
+# final fit and with the concurrent block fit (fitBlockSize>0), and
+# checks that the resulting tracks are identical.
+#
+#   cmsRun testFitBlockSize_cfg.py inputFiles=<GEN-SIM-DIGI-RAW file> maxEvents=10
+
+import FWCore.ParameterSet.Config as cms
+from FWCore.ParameterSet.VarParsing import VarParsing
+
+options = VarParsing('analysis')
+options.parseArguments()
+
+from Configuration.Eras.Era_Run2_2018_cff import Run2_2018
+process = cms.Process("FitBlockSize", Run2_2018)
+
+process.load('Configuration.StandardSequences.Services_cff')
+process.load('FWCore.MessageService.MessageLogger_cfi')
+process.load('Configuration.StandardSequences.GeometryRecoDB_cff')
+process.load('Configuration.StandardSequences.MagneticField_cff')
+process.load('Configuration.StandardSequences.RawToDigi_cff')
+process.load('Configuration.StandardSequences.Reconstruction_cff')
+process.load('Configuration.StandardSequences.FrontierConditions_GlobalTag_cff')
+from Configuration.AlCa.GlobalTag import GlobalTag
+process.GlobalTag = GlobalTag(process.GlobalTag, 'auto:phase1_2018_realistic', '')
+
+process.options = cms.untracked.PSet(numberOfThreads = cms.untracked.uint32(4),
+                                     numberOfStreams = cms.untracked.uint32(0))
+
+process.source = cms.Source("PoolSource",
+                            fileNames = cms.untracked.vstring(options.inputFiles))
+process.maxEvents = cms.untracked.PSet(input = cms.untracked.int32(options.maxEvents))
+
+# same candidates, fitted concurrently in small blocks
+process.initialStepTracksBlockFit = process.initialStepTracks.clone(fitBlockSize = 4)
+process.lowPtTripletStepTracksBlockFit = process.lowPtTripletStepTracks.clone(fitBlockSize = 4)
+
+process.compareInitialStep = cms.EDAnalyzer("TrackCollectionComparator",
+    reference = cms.InputTag("initialStepTracks"),
+    tracks = cms.InputTag("initialStepTracksBlockFit")
+)
+process.compareLowPtTripletStep = cms.EDAnalyzer("TrackCollectionComparator",
+    reference = cms.InputTag("lowPtTripletStepTracks"),
+    tracks = cms.InputTag("lowPtTripletStepTracksBlockFit")
+)
+
+process.p = cms.Path(process.RawToDigi +
+                     process.reconstruction_trackingOnly +
+                     process.initialStepTracksBlockFit +
+                     process.lowPtTripletStepTracksBlockFit +
+                     process.compareInitialStep +
+                     process.compareLowPtTripletStep)
@@ -32,6 +32,8 @@ public:
       
       pi.push_back( new_pi ); // track weight
       Z_sum.push_back( 1.0); // Z[i]   for DA clustering, initial value as done in ::fill
+      kmin.push_back( 0 ); // first vertex within zrange, updated in ::set_vtx_range
+      kmax.push_back( 0 ); // one past the last vertex within zrange
     }
 
     
@@ -49,6 +51,8 @@ public:
       _dz2 = &dz2.front();
       _Z_sum = &Z_sum.front();
       _pi = &pi.front();
+      _kmin = &kmin.front();
+      _kmax = &kmax.front();
     }
     
     double * __restrict__ _z; // z-coordinate at point of closest approach to the beamline
@@ -56,6 +60,8 @@ public:
     
     double * __restrict__  _Z_sum; // Z[i]   for DA clustering
     double * __restrict__  _pi; // track weight
+    unsigned int * __restrict__ _kmin; // index of the first cluster within zrange
+    unsigned int * __restrict__ _kmax; // 1 + index of the last cluster within zrange
     
     std::vector<double> z; // z-coordinate at point of closest approach to the beamline
     std::vector<double> dz2; // square of the error of z(pca)
@@ -63,6 +69,8 @@ public:
     
     std::vector<double> Z_sum; // Z[i]   for DA clustering
     std::vector<double> pi; // track weight
+    std::vector<unsigned int> kmin; // index of the first cluster within zrange
+    std::vector<unsigned int> kmax; // 1 + index of the last cluster within zrange
   };
   
   struct vertex_t {
@@ -181,6 +189,8 @@ public:
   double update(double beta, track_t & gtracks,
 		vertex_t & gvertices, bool useRho0, const double & rho0) const;
 
+  void set_vtx_range(double beta, track_t & gtracks, vertex_t & gvertices) const;
+
   void dump(const double beta, const vertex_t & y,
 	    const track_t & tks, const int verbosity = 0) const;
   bool merge(vertex_t & y, double & beta)const;
@@ -211,6 +221,15 @@ private:
   double zmerge_;
   double betapurge_;
 
+  // sparse track-cluster interaction: only clusters within zrange_ (in units
+  // of the temperature-broadened track resolution) enter the sums, 0 = all
+  double zrange_;
+  double zrangeMin_;
+  // intra-event parallelism: the z-sorted tracks are split into blocks of
+  // blockSize_ which are updated concurrently and reduced in a fixed order
+  bool runInParallel_;
+  unsigned int blockSize_;
+
 };
 
 
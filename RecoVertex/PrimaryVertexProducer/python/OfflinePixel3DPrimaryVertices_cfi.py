@@ -28,6 +28,9 @@ pixelVertices = cms.EDProducer("PrimaryVertexProducer",
             coolingFactor = cms.double(0.6),
             vertexSize = cms.double(0.01),
             zmerge = cms.double(0.01),
+            zrange = cms.double(0.),
+            runInParallel = cms.bool(False),
+            blockSize = cms.uint32(512),
             uniquetrkweight = cms.double(0.9)
         )
     ),
@@ -11,6 +11,9 @@ DA_vectParameters = cms.PSet(
         d0CutOff = cms.double(3.),        # downweight high IP tracks 
         dzCutOff = cms.double(3.),        # outlier rejection after freeze-out (T<Tmin)       
         zmerge = cms.double(1e-2),        # merge intermediat clusters separated by less than zmerge
+        zrange = cms.double(0.),          # only consider clusters within zrange*sigma(T) of a track, 0 = all
+        runInParallel = cms.bool(False),  # update blocks of z-ordered tracks concurrently, requires zrange > 0
+        blockSize = cms.uint32(512),      # number of tracks per block when running in parallel
         uniquetrkweight = cms.double(0.8) # require at least two tracks with this weight at T=Tpurge
         )
 )
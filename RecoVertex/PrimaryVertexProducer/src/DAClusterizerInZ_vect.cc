@@ -7,8 +7,11 @@
 #include <cassert>
 #include <limits>
 #include <iomanip>
+#include <numeric>
 #include "FWCore/Utilities/interface/isFinite.h"
 #include "vdt/vdtMath.h"
+#include "tbb/task_arena.h"
+#include "tbb/tbb.h"
 
 using namespace std;
 
@@ -17,6 +20,7 @@ DAClusterizerInZ_vect::DAClusterizerInZ_vect(const edm::ParameterSet& conf) {
   // hardcoded parameters
   maxIterations_ = 100;
   mintrkweight_ = 0.5; // conf.getParameter<double>("mintrkweight");
+  zrangeMin_ = 0.1; // never restrict the track-cluster interaction to less than 1 mm
 
 
   // configurable debug outptut debug output
@@ -39,6 +43,20 @@ DAClusterizerInZ_vect::DAClusterizerInZ_vect(const edm::ParameterSet& conf) {
   dzCutOff_ = conf.getParameter<double> ("dzCutOff");
   uniquetrkweight_ = conf.getParameter<double>("uniquetrkweight");
   zmerge_ = conf.getParameter<double>("zmerge");
+  zrange_ = conf.getParameter<double>("zrange");
+  runInParallel_ = conf.getParameter<bool> ("runInParallel");
+  blockSize_ = conf.getParameter<unsigned int> ("blockSize");
+  if (blockSize_ == 0) {
+    edm::LogWarning("DAClusterizerinZ_vectorized") << "DAClusterizerInZ: invalid blockSize " << blockSize_
+						   << "  set to 512";
+    blockSize_ = 512;
+  }
+  // with dense sums every block would need private sums over all clusters
+  if (runInParallel_ && (zrange_ <= 0)) {
+    edm::LogWarning("DAClusterizerinZ_vectorized") << "DAClusterizerInZ: runInParallel requires zrange > 0,"
+						   << " running serially";
+    runInParallel_ = false;
+  }
 
   if(verbose_){
     std::cout << "DAClusterizerinZ_vect: mintrkweight = " << mintrkweight_ << std::endl;
@@ -51,6 +69,9 @@ DAClusterizerInZ_vect::DAClusterizerInZ_vect(const edm::ParameterSet& conf) {
     std::cout << "DAClusterizerinZ_vect: coolingFactor = " << coolingFactor_ << std::endl;
     std::cout << "DAClusterizerinZ_vect: d0CutOff = " << d0CutOff_ << std::endl;
     std::cout << "DAClusterizerinZ_vect: dzCutOff = " << dzCutOff_ << std::endl;
+    std::cout << "DAClusterizerinZ_vect: zrange = " << zrange_ << std::endl;
+    std::cout << "DAClusterizerinZ_vect: runInParallel = " << runInParallel_ << std::endl;
+    std::cout << "DAClusterizerinZ_vect: blockSize = " << blockSize_ << std::endl;
   }
 
 
@@ -120,6 +141,18 @@ DAClusterizerInZ_vect::fill(const vector<reco::TransientTrack> & tracks) const {
     LogTrace("DAClusterizerinZ_vectorized") << t_z <<' '<< t_dz2 <<' '<< t_pi;
     tks.AddItem(t_z, t_dz2, &(*it), t_pi);
   }
+
+  // order the tracks in z, this keeps the cluster ranges of neighbouring tracks
+  // (and hence of the blocks updated in parallel) compact; dense sums keep the
+  // input order so that the summation order and the output do not change
+  if ( (zrange_ > 0) || runInParallel_ ) {
+    std::vector<unsigned int> order(tks.GetSize());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&tks](unsigned int a, unsigned int b){ return tks.z[a] < tks.z[b]; });
+    track_t sorted;
+    for (auto i : order) sorted.AddItem(tks.z[i], tks.dz2[i], tks.tt[i], tks.pi[i]);
+    tks = std::move(sorted);
+  }
   tks.ExtractRaw();
   
   if (verbose_) {
@@ -137,6 +170,43 @@ namespace {
   }
 }
 
+void DAClusterizerInZ_vect::set_vtx_range(double beta, track_t & gtracks, vertex_t & gvertices) const {
+
+  // find for every track the range [kmin,kmax) of clusters it interacts with,
+  // clusters further away than zrange_ times the temperature-broadened track
+  // resolution get a weight below exp(-zrange_^2) and are ignored
+  const unsigned int nt = gtracks.GetSize();
+  const unsigned int nv = gvertices.GetSize();
+
+  if ( (zrange_ <= 0) || (nv == 0) ) {
+    for (auto itrack = 0U; itrack < nt; ++itrack) {
+      gtracks._kmin[itrack] = 0;
+      gtracks._kmax[itrack] = nv;
+    }
+    return;
+  }
+
+  for (auto itrack = 0U; itrack < nt; ++itrack) {
+    const double zrange = std::max(zrange_ / std::sqrt(beta * gtracks._dz2[itrack]), zrangeMin_);
+    const double zmin = gtracks._z[itrack] - zrange;
+    const double zmax = gtracks._z[itrack] + zrange;
+
+    // clusters are ordered in z and move little between updates,
+    // start the search from the range found previously
+    unsigned int kmin = std::min(nv, gtracks._kmin[itrack]);
+    while ( (kmin > 0) && (gvertices._z[kmin - 1] >= zmin) ) kmin--;
+    while ( (kmin < nv) && (gvertices._z[kmin] < zmin) ) kmin++;
+
+    unsigned int kmax = std::max(kmin, std::min(nv, gtracks._kmax[itrack]));
+    while ( (kmax > kmin) && (gvertices._z[kmax - 1] > zmax) ) kmax--;
+    while ( (kmax < nv) && (gvertices._z[kmax] <= zmax) ) kmax++;
+
+    gtracks._kmin[itrack] = kmin;
+    gtracks._kmax[itrack] = kmax;
+  }
+}
+
+
 double DAClusterizerInZ_vect::update(double beta, track_t & gtracks,
 				     vertex_t & gvertices, bool useRho0, const double & rho0) const {
 
@@ -146,6 +216,8 @@ double DAClusterizerInZ_vect::update(double beta, track_t & gtracks,
   
   const unsigned int nt = gtracks.GetSize();
   const unsigned int nv = gvertices.GetSize();
+
+  set_vtx_range(beta, gtracks, gvertices);
   
   //initialize sums
   double sumpi = 0;
@@ -162,46 +234,63 @@ double DAClusterizerInZ_vect::update(double beta, track_t & gtracks,
       Z_init = rho0 * local_exp(-beta * dzCutOff_ * dzCutOff_); // cut-off
     }
   
-  // define kernels
-  auto kernel_calc_exp_arg = [ beta, nv ] ( const unsigned int itrack,
-					     track_t const& tracks,
-					     vertex_t const& vertices ) {
-    const double track_z = tracks._z[itrack];
-    const double botrack_dz2 = -beta*tracks._dz2[itrack];
-
-    // auto-vectorized
-    for ( unsigned int ivertex = 0; ivertex < nv; ++ivertex) {
-      auto mult_res =  track_z - vertices._z[ivertex];
-      vertices._ei_cache[ivertex] = botrack_dz2 * ( mult_res * mult_res );
-    }
-  };
-  
-  auto kernel_add_Z = [ nv, Z_init ] (vertex_t const& vertices) -> double
-    {
+  // define kernel, processes the tracks [ifirst,ilast) and accumulates into
+  // arrays holding the clusters starting at koffset, returns the sum of track weights
+  auto kernel_tracks = [ beta, Z_init ] ( const unsigned int ifirst, const unsigned int ilast,
+					  track_t & tks_vec, vertex_t const & y_vec,
+					  const unsigned int koffset,
+					  double * ei_cache, double * ei,
+					  double * se, double * sw, double * swz, double * swE ) -> double {
+    double sumpi = 0;
+    auto obeta =  -1./beta;
+
+    for (auto itrack = ifirst; itrack < ilast; ++itrack) {
+      const unsigned int kmin = tks_vec._kmin[itrack];
+      const unsigned int nk = tks_vec._kmax[itrack] - kmin;
+      const double * __restrict__ y_z = y_vec._z + kmin;
+      const double * __restrict__ y_pk = y_vec._pk + kmin;
+      double * __restrict__ t_ei_cache = ei_cache + (kmin - koffset);
+      double * __restrict__ t_ei = ei + (kmin - koffset);
+
+      const double track_z = tks_vec._z[itrack];
+      const double botrack_dz2 = -beta*tks_vec._dz2[itrack];
+
+      // auto-vectorized
+      for (unsigned int k = 0; k < nk; ++k) {
+	auto mult_res =  track_z - y_z[k];
+	t_ei_cache[k] = botrack_dz2 * ( mult_res * mult_res );
+      }
+      local_exp_list(t_ei_cache, t_ei, nk);
+
       double ZTemp = Z_init;
-      for (unsigned int ivertex = 0; ivertex < nv; ++ivertex) {	
-	ZTemp += vertices._pk[ivertex] * vertices._ei[ivertex];
+      for (unsigned int k = 0; k < nk; ++k) {
+	ZTemp += y_pk[k] * t_ei[k];
+      }
+      if (edm::isNotFinite(ZTemp)) ZTemp = 0.0;
+      tks_vec._Z_sum[itrack] = ZTemp;
+      // used in the next major loop to follow
+      sumpi += tks_vec._pi[itrack];
+
+      if (ZTemp > 1.e-100) {
+	double * __restrict__ t_se = se + (kmin - koffset);
+	double * __restrict__ t_sw = sw + (kmin - koffset);
+	double * __restrict__ t_swz = swz + (kmin - koffset);
+	double * __restrict__ t_swE = swE + (kmin - koffset);
+	auto tmp_trk_pi = tks_vec._pi[itrack];
+	auto o_trk_Z_sum = 1./ZTemp;
+	auto o_trk_dz2 = tks_vec._dz2[itrack];
+
+	// auto-vectorized
+	for (unsigned int k = 0; k < nk; ++k) {
+	  t_se[k] +=  t_ei[k] * (tmp_trk_pi* o_trk_Z_sum);
+	  auto w = y_pk[k] * t_ei[k] * (tmp_trk_pi*o_trk_Z_sum *o_trk_dz2);
+	  t_sw[k]  += w;
+	  t_swz[k] += w * track_z;
+	  t_swE[k] += w * t_ei_cache[k]*obeta;
+	}
       }
-      return ZTemp;
-    };
-
-  auto kernel_calc_normalization = [ beta, nv ] (const unsigned int track_num,
-						  track_t & tks_vec,
-						  vertex_t & y_vec ) {
-    auto tmp_trk_pi = tks_vec._pi[track_num];
-    auto o_trk_Z_sum = 1./tks_vec._Z_sum[track_num];
-    auto o_trk_dz2 = tks_vec._dz2[track_num];
-    auto tmp_trk_z = tks_vec._z[track_num];
-    auto obeta =  -1./beta;
-    
-    // auto-vectorized
-    for (unsigned int k = 0; k < nv; ++k) {
-      y_vec._se[k] +=  y_vec._ei[k] * (tmp_trk_pi* o_trk_Z_sum);
-      auto w = y_vec._pk[k] * y_vec._ei[k] * (tmp_trk_pi*o_trk_Z_sum *o_trk_dz2);
-      y_vec._sw[k]  += w;
-      y_vec._swz[k] += w * tmp_trk_z;
-      y_vec._swE[k] += w * y_vec._ei_cache[k]*obeta;
     }
+    return sumpi;
   };
   
   
@@ -213,19 +302,53 @@ double DAClusterizerInZ_vect::update(double beta, track_t & gtracks,
   }
   
   
-  
-  // loop over tracks
-  for (auto itrack = 0U; itrack < nt; ++itrack) {
-    kernel_calc_exp_arg(itrack, gtracks, gvertices);
-    local_exp_list(gvertices._ei_cache, gvertices._ei, nv);
-    
-    gtracks._Z_sum[itrack] = kernel_add_Z(gvertices);
-    if (edm::isNotFinite(gtracks._Z_sum[itrack])) gtracks._Z_sum[itrack] = 0.0;
-    // used in the next major loop to follow
-    sumpi += gtracks._pi[itrack];
-    
-    if (gtracks._Z_sum[itrack] > 1.e-100){
-      kernel_calc_normalization(itrack, gtracks, gvertices);
+  const unsigned int nblocks = runInParallel_ ? (nt + blockSize_ - 1) / blockSize_ : 1;
+  if (nblocks < 2) {
+    // loop over tracks
+    sumpi = kernel_tracks(0, nt, gtracks, gvertices, 0,
+			  gvertices._ei_cache, gvertices._ei,
+			  gvertices._se, gvertices._sw, gvertices._swz, gvertices._swE);
+  } else {
+    // the tracks are ordered in z: each block of tracks covers a z region and
+    // only touches the clusters within it, blocks are processed concurrently
+    // with private accumulators which are then summed in block order, so that
+    // the result does not depend on the scheduling
+    std::vector<unsigned int> kfirst(nblocks), klast(nblocks);
+    std::vector<double> bsumpi(nblocks, 0.);
+    std::vector<std::vector<double> > bsums(nblocks);
+
+    tbb::this_task_arena::isolate([&] {
+      tbb::parallel_for(0U, nblocks, [&](unsigned int ib) {
+	const unsigned int ifirst = ib * blockSize_;
+	const unsigned int ilast = std::min(nt, ifirst + blockSize_);
+	unsigned int k0 = nv, k1 = 0;
+	for (auto itrack = ifirst; itrack < ilast; ++itrack) {
+	  k0 = std::min(k0, gtracks._kmin[itrack]);
+	  k1 = std::max(k1, gtracks._kmax[itrack]);
+	}
+	if (k1 < k0) k1 = k0;
+	const unsigned int nk = k1 - k0;
+	kfirst[ib] = k0;
+	klast[ib] = k1;
+
+	auto & b = bsums[ib];
+	b.assign(6 * nk, 0.0);
+	bsumpi[ib] = kernel_tracks(ifirst, ilast, gtracks, gvertices, k0,
+				   b.data(), b.data() + nk,
+				   b.data() + 2 * nk, b.data() + 3 * nk, b.data() + 4 * nk, b.data() + 5 * nk);
+      });
+    });
+
+    for (auto ib = 0U; ib < nblocks; ++ib) {
+      sumpi += bsumpi[ib];
+      const unsigned int nk = klast[ib] - kfirst[ib];
+      const double * b = bsums[ib].data();
+      for (unsigned int k = 0; k < nk; ++k) {
+	gvertices._se[kfirst[ib] + k] += b[2 * nk + k];
+	gvertices._sw[kfirst[ib] + k] += b[3 * nk + k];
+	gvertices._swz[kfirst[ib] + k] += b[4 * nk + k];
+	gvertices._swE[kfirst[ib] + k] += b[5 * nk + k];
+      }
     }
   }
   
@@ -336,6 +459,8 @@ DAClusterizerInZ_vect::purge(vertex_t & y, track_t & tks, double & rho0, const d
 
     double pmax = y._pk[k] / (y._pk[k] + rho0 * local_exp(-beta * dzCutOff_* dzCutOff_));
     for (unsigned int i = 0; i < nt; i++) {
+      // Z_sum only contains the clusters in the range of the track (see update)
+      if ( (k < tks._kmin[i]) || (k >= tks._kmax[i]) ) continue;
       if (tks._Z_sum[i] > 1.e-100) {
 	double p = y._pk[k] * local_exp(-beta * Eik(tks._z[i], y._z[k], tks._dz2[i])) / tks._Z_sum[i];
 	sump += p;
@@ -440,6 +565,10 @@ DAClusterizerInZ_vect::split(const double beta,  track_t &tks, vertex_t & y, dou
 
 
   std::stable_sort(critical.begin(), critical.end(), std::greater<std::pair<double, unsigned int> >() );
+
+  // the track cluster ranges refer to the cluster indices before splitting
+  std::vector<unsigned int> kupdate(critical.size());
+  for(unsigned int ic=0; ic<critical.size(); ic++) kupdate[ic] = critical[ic].second;
   
   
   bool split=false;
@@ -447,11 +576,14 @@ DAClusterizerInZ_vect::split(const double beta,  track_t &tks, vertex_t & y, dou
 
   for(unsigned int ic=0; ic<critical.size(); ic++){
     unsigned int k=critical[ic].second;
+    const unsigned int ku = kupdate[ic];
 
     // estimate subcluster positions and weight
     double p1=0, z1=0, w1=0;
     double p2=0, z2=0, w2=0;
     for(unsigned int i=0; i<nt; i++){
+      // Z_sum only contains the clusters in the range of the track (see update)
+      if ( (ku < tks._kmin[i]) || (ku >= tks._kmax[i]) ) continue;
       if (tks._Z_sum[i] > 1.e-100) {
 
 	// winner-takes-all, usually overestimates splitting
@@ -102,6 +102,8 @@ class EcalHitResponse
 
       double timeOfFlight( const DetId& detId ) const ;
 
+      double computeTimeOfFlight( const DetId& detId ) const ;
+
       double phaseShift() const ;
 
       void blankOutUsedSamples() ;
@@ -141,6 +143,8 @@ class EcalHitResponse
       CalibCache                     m_laserCalibCache;
 
       VecInd m_index ;
+
+      std::vector<double> m_timeOfFlight ; // per dense index, filled in setGeometry
 };
 
 #endif
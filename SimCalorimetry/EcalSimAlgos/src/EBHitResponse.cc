@@ -115,9 +115,10 @@ EBHitResponse::putAPDSignal( const DetId& detId  ,
 
    EcalSamples& result ( *findSignal( detId ) );
 
+   const CaloVShape& pulse ( *apdShape() ) ;
    for( unsigned int bin ( 0 ) ; bin != result.size(); ++bin )
    {
-      result[bin] += (*apdShape())(binTime)*signal ;
+      result[bin] += pulse(binTime)*signal ;
       binTime += BUNCHSPACE ;
    }
 }
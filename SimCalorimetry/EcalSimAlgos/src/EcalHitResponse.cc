@@ -73,6 +73,16 @@ void
 EcalHitResponse::setGeometry( const CaloSubdetectorGeometry* geometry )
 {
   m_geometry = geometry ;
+
+  // tabulate the time of flight of every cell once per geometry instead of
+  // fetching the cell geometry for each hit; -1 marks cells not in the table
+  m_timeOfFlight.assign( samplesSizeAll(), -1. ) ;
+  if( nullptr == m_geometry ) return ;
+  for( auto const& id : m_geometry->getValidDetIds() )
+  {
+     const unsigned int di ( CaloGenericDetId( id ).denseIndex() ) ;
+     if( di < m_timeOfFlight.size() ) m_timeOfFlight[ di ] = computeTimeOfFlight( id ) ;
+  }
 }
 
 void 
@@ -226,9 +236,10 @@ EcalHitResponse::putAnalogSignal( const PCaloHit& hit, CLHEP::HepRandomEngine* e
 
    const unsigned int rsize ( result.size() ) ;
 
+   const CaloVShape& pulse ( *shape() ) ;
    for( unsigned int bin ( 0 ) ; bin != rsize ; ++bin )
    {
-      result[ bin ] += (*shape())( binTime )*signal ;
+      result[ bin ] += pulse( binTime )*signal ;
       binTime += BUNCHSPACE ;
    }
 }
@@ -281,6 +292,14 @@ EcalHitResponse::analogSignalAmplitude( const DetId& detId, double energy, CLHEP
 
 double 
 EcalHitResponse::timeOfFlight( const DetId& detId ) const 
+{
+  const unsigned int di ( CaloGenericDetId( detId ).denseIndex() ) ;
+  if( di < m_timeOfFlight.size() && 0. <= m_timeOfFlight[ di ] ) return m_timeOfFlight[ di ] ;
+  return computeTimeOfFlight( detId ) ;
+}
+
+double 
+EcalHitResponse::computeTimeOfFlight( const DetId& detId ) const 
 {
   auto cellGeometry ( geometry()->getGeometry( detId ) ) ;
   assert( nullptr != cellGeometry ) ;
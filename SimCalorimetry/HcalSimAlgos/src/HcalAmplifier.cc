@@ -88,7 +88,7 @@ void HcalAmplifier::addPedestals(CaloSamples & frame, CLHEP::HepRandomEngine* en
   if(addNoise_)
   {
     double gauss [32]; //big enough
-    for (int i = 0; i < frame.size(); i++) gauss[i] = CLHEP::RandGaussQ::shoot(engine, 0., 1.);
+    CLHEP::RandGaussQ::shootArray(engine, frame.size(), gauss, 0., 1.);
     makeNoise(hcalSubDet, calibWidths, frame.size(), gauss, noise);
   }
    
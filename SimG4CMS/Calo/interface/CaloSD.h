@@ -33,6 +33,7 @@
 #include <fstream>
 #include <vector>
 #include <map>
+#include <unordered_map>
 
 class G4Step;
 class G4HCofThisEvent;
@@ -139,12 +140,31 @@ protected:
 
 private:
 
+  // Hash and equality over the fields CaloHitID::operator< orders on, so
+  // that lookups match exactly the hits an ordered map would find
+  struct CaloHitIDHash {
+    std::size_t operator()(const CaloHitID& id) const {
+      std::size_t h = id.unitID();
+      h = h*0x9E3779B97F4A7C15ULL + static_cast<uint32_t>(id.trackID());
+      h = h*0x9E3779B97F4A7C15ULL + static_cast<uint32_t>(id.timeSliceID());
+      h = h*0x9E3779B97F4A7C15ULL + id.depth();
+      return h ^ (h >> 29);
+    }
+  };
+  struct CaloHitIDKeyEqual {
+    bool operator()(const CaloHitID& a, const CaloHitID& b) const {
+      return (a.unitID() == b.unitID() && a.trackID() == b.trackID() &&
+              a.timeSliceID() == b.timeSliceID() && a.depth() == b.depth());
+    }
+  };
+  typedef std::unordered_map<CaloHitID,CaloG4Hit*,CaloHitIDHash,CaloHitIDKeyEqual> HitMap;
+
   float                           timeSlice;
   bool                            ignoreTrackID;
   CaloSlaveSD*                    slave;
   int                             hcID;
   CaloG4HitCollection*            theHC; 
-  std::map<CaloHitID,CaloG4Hit*>  hitMap;
+  HitMap                          hitMap;
 
   std::map<int,TrackWithHistory*> tkMap;
   CaloMeanResponse*               meanResponse;
@@ -54,6 +54,7 @@ protected:
 
   bool                rInside(double r);
   void                getRecord(int, int);
+  void                readRecord(int, int);
   void                loadEventInfo(TBranch *);
   void                interpolate(int, double);
   void                extrapolate(int, double);
@@ -63,6 +64,18 @@ protected:
 
 private:
 
+  // photons of all the records decoded once and shared by all the libraries
+  // reading the same branches of the same file: record r (from 1) of type t
+  // (0 em, 1 had) is photons[offsets[t][r-1]] ... photons[offsets[t][r]-1]
+  struct PhotonCache {
+    HFShowerPhotonCollection  photons;
+    std::vector<unsigned int> offsets[2];
+  };
+  // keyed by file and branch names, holds the caches while a library uses them
+  class PhotonCacheRegistry;
+  static std::shared_ptr<const PhotonCache> sharedCache(const std::string &,
+							 HFShowerLibrary *);
+
   HFFibre *           fibre;
   TFile *             hf;
   TBranch             *emBranch, *hadBranch;
@@ -84,6 +97,7 @@ private:
   HFShowerPhotonCollection pe;
   HFShowerPhotonCollection* photo;
   HFShowerPhotonCollection photon;
+  std::shared_ptr<const PhotonCache> cache;
 
 };
 #endif
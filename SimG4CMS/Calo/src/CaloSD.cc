@@ -306,7 +306,7 @@ G4bool CaloSD::checkHit() {
   //look in the HitContainer whether a hit with the same ID already exists:
   bool       found = false;
   if (useMap) {
-    std::map<CaloHitID,CaloG4Hit*>::const_iterator it = hitMap.find(currentID);
+    HitMap::const_iterator it = hitMap.find(currentID);
     if (it != hitMap.end()) {
       currentHit = it->second;
       found      = true;
@@ -357,10 +357,11 @@ CaloG4Hit* CaloSD::createNewHit() {
   
   CaloG4Hit* aHit;
   if (!reusehit.empty()) {
-    aHit = reusehit[0];
+    // every field is reset below, so which spare hit is taken does not matter
+    aHit = reusehit.back();
     aHit->setEM(0.);
     aHit->setHadr(0.);
-    reusehit.erase(reusehit.begin());
+    reusehit.pop_back();
   } else {
     aHit = new CaloG4Hit;
   }
@@ -528,7 +529,7 @@ void CaloSD::update(const ::EndOfEvent * ) {
 }
 
 void CaloSD::clearHits() {  
-  if (useMap) hitMap.erase (hitMap.begin(), hitMap.end());
+  if (useMap) hitMap.clear(); // keeps the buckets for the next event
   for (unsigned int i = 0; i<reusehit.size(); ++i) delete reusehit[i];
   std::vector<CaloG4Hit*>().swap(reusehit);
   cleanIndex  = 0;
@@ -10,6 +10,7 @@
 #include "DetectorDescription/Core/interface/DDValue.h"
 
 #include "FWCore/Utilities/interface/Exception.h"
+#include "FWCore/Utilities/interface/thread_safety_macros.h"
 
 #include "G4VPhysicalVolume.hh"
 #include "G4NavigationHistory.hh"
@@ -19,6 +20,9 @@
 #include "CLHEP/Units/GlobalSystemOfUnits.h"
 #include "CLHEP/Units/GlobalPhysicalConstants.h"
 
+#include <map>
+#include <mutex>
+
 //#define DebugLog
 
 HFShowerLibrary::HFShowerLibrary(const std::string & name, const DDCompactView & cpv,
@@ -42,6 +46,7 @@ HFShowerLibrary::HFShowerLibrary(const std::string & name, const DDCompactView &
   std::string branchPost   = m_HS.getUntrackedParameter<std::string>("BranchPost","_R.obj");
   verbose                  = m_HS.getUntrackedParameter<bool>("Verbosity",false);
   applyFidCut              = m_HS.getParameter<bool>("ApplyFiducialCut");
+  bool cacheLibrary        = m_HS.getUntrackedParameter<bool>("CacheLibrary",false);
 
   if (pTreeName.find(".") == 0) pTreeName.erase(0,2);
   const char* nTree = pTreeName.c_str();
@@ -92,11 +97,11 @@ HFShowerLibrary::HFShowerLibrary(const std::string & name, const DDCompactView &
     edm::LogInfo("HFShower") << "HFShowerLibrary: pmom[" << i << "] = "
 			     << pmom[i]/GeV << " GeV";
 
-  std::string nameBr = branchPre + emName + branchPost;
-  emBranch         = event->GetBranch(nameBr.c_str());
+  std::string emBranchName  = branchPre + emName + branchPost;
+  emBranch         = event->GetBranch(emBranchName.c_str());
   if (verbose) emBranch->Print();
-  nameBr           = branchPre + hadName + branchPost;
-  hadBranch        = event->GetBranch(nameBr.c_str());
+  std::string hadBranchName = branchPre + hadName + branchPost;
+  hadBranch        = event->GetBranch(hadBranchName.c_str());
   if (verbose) hadBranch->Print();
 
   v3version=false;
@@ -119,6 +124,10 @@ HFShowerLibrary::HFShowerLibrary(const std::string & name, const DDCompactView &
   
   fibre = new HFFibre(name, cpv, p);
   photo = new HFShowerPhotonCollection;
+  // the cached photons depend on the branches read (and the format they
+  // imply) as well as on the file
+  if (cacheLibrary) cache = sharedCache(pTreeName + "|" + branchEvInfo + "|" +
+					emBranchName + "|" + hadBranchName, this);
   emPDG = epPDG = gammaPDG = 0;
   pi0PDG = etaPDG = nuePDG = numuPDG = nutauPDG= 0;
   anuePDG= anumuPDG = anutauPDG = geantinoPDG = 0;
@@ -391,6 +400,30 @@ bool HFShowerLibrary::rInside(double r) {
 
 void HFShowerLibrary::getRecord(int type, int record) {
 
+  if (cache) {
+    int nrc     = record-1;
+    photon.clear();
+    photo->clear();
+    const std::vector<unsigned int> & offsets = cache->offsets[(type > 0) ? 1 : 0];
+    HFShowerPhotonCollection & list = (newForm) ? (*photo) : photon;
+    list.assign(cache->photons.begin()+offsets[nrc],
+		cache->photons.begin()+offsets[nrc+1]);
+  } else {
+    readRecord(type, record);
+  }
+#ifdef DebugLog
+  int nPhoton = (newForm) ? photo->size() : photon.size();
+  LogDebug("HFShower") << "HFShowerLibrary::getRecord: Record " << record
+		       << " of type " << type << " with " << nPhoton 
+		       << " photons";
+  for (int j = 0; j < nPhoton; j++) 
+    if (newForm) LogDebug("HFShower") << "Photon " << j << " " << photo->at(j);
+    else         LogDebug("HFShower") << "Photon " << j << " " << photon[j];
+#endif
+}
+
+void HFShowerLibrary::readRecord(int type, int record) {
+
   int nrc     = record-1;
   photon.clear();
   photo->clear();
@@ -437,15 +470,52 @@ void HFShowerLibrary::getRecord(int type, int record) {
       emBranch->GetEntry(nrc);
     }
   }
-#ifdef DebugLog
-  int nPhoton = (newForm) ? photo->size() : photon.size();
-  LogDebug("HFShower") << "HFShowerLibrary::getRecord: Record " << record
-		       << " of type " << type << " with " << nPhoton 
-		       << " photons";
-  for (int j = 0; j < nPhoton; j++) 
-    if (newForm) LogDebug("HFShower") << "Photon " << j << " " << photo->at(j);
-    else         LogDebug("HFShower") << "Photon " << j << " " << photon[j];
-#endif
+}
+
+class HFShowerLibrary::PhotonCacheRegistry {
+public:
+  std::shared_ptr<const PhotonCache> get(const std::string & key, HFShowerLibrary * lib);
+private:
+  // guards caches, the libraries of all the threads go through it
+  std::mutex mutex;
+  std::map<std::string,std::weak_ptr<const PhotonCache> > caches;
+};
+
+std::shared_ptr<const HFShowerLibrary::PhotonCache> 
+HFShowerLibrary::sharedCache(const std::string & key, HFShowerLibrary * lib) {
+
+  // all the accesses to the registry are serialized by its mutex
+  CMS_THREAD_SAFE static PhotonCacheRegistry registry;
+  return registry.get(key, lib);
+}
+
+std::shared_ptr<const HFShowerLibrary::PhotonCache> 
+HFShowerLibrary::PhotonCacheRegistry::get(const std::string & key, HFShowerLibrary * lib) {
+
+  std::lock_guard<std::mutex> guard(mutex);
+  std::shared_ptr<const PhotonCache> cache = caches[key].lock();
+  if (!cache) {
+    auto newCache = std::make_shared<PhotonCache>();
+    for (int type=0; type<2; ++type) {
+      std::vector<unsigned int> & offsets = newCache->offsets[type];
+      offsets.reserve(lib->totEvents+1);
+      offsets.push_back(0);
+      for (int record=1; record<=lib->totEvents; ++record) {
+	lib->readRecord(type, record);
+	const HFShowerPhotonCollection & list = (lib->newForm) ? (*lib->photo) : lib->photon;
+	newCache->photons.insert(newCache->photons.end(), list.begin(), list.end());
+	offsets.push_back(newCache->photons.size());
+      }
+    }
+    lib->photon.clear();
+    lib->photo->clear();
+    edm::LogInfo("HFShower") << "HFShowerLibrary: cached " 
+			     << newCache->photons.size() << " photons of "
+			     << 2*lib->totEvents << " records of " << key;
+    cache = newCache;
+    caches[key] = cache;
+  }
+  return cache;
 }
 
 void HFShowerLibrary::loadEventInfo(TBranch* branch) {
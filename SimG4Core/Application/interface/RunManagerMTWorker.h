@@ -36,6 +36,17 @@ class SensitiveCaloDetector;
 class SimWatcher;
 class SimProducer;
 
+/**
+ * One RunManagerMTWorker per stream, with the Geant4 state kept per
+ * thread (TLSData) and initialized lazily on the first event a thread
+ * processes. The world volume, the production cuts, the physics tables
+ * and the sensitive detector catalog are built once by RunManagerMT and
+ * shared read-only; what a worker builds itself (field manager and
+ * stepper, sensitive detector instances, user actions, the worker
+ * kernel) holds per-thread mutable state by design of Geant4 MT.
+ * An event is simulated by a single worker: the Geant4 event loop has
+ * no means to split the primaries of one G4Event between threads.
+ */
 class RunManagerMTWorker {
 public:
   explicit RunManagerMTWorker(const edm::ParameterSet& iConfig, edm::ConsumesCollector&& i);
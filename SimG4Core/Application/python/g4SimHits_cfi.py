@@ -348,7 +348,10 @@ g4SimHits = cms.EDProducer("OscarMTProducer",
         ApplyFiducialCut= cms.bool(True),
         BranchPost      = cms.untracked.string(''),
         BranchEvt       = cms.untracked.string(''),
-        BranchPre       = cms.untracked.string('')
+        BranchPre       = cms.untracked.string(''),
+        # decode the whole library once, shared by all threads, instead of
+        # reading a ROOT entry for every sampled shower
+        CacheLibrary    = cms.untracked.bool(False)
     ),
     HFShowerPMT = cms.PSet(
         common_UsePMT,
@@ -226,8 +226,9 @@ void RunManagerMTWorker::initializeThread(RunManagerMT& runManagerMaster, const
   // we need the track manager now
   m_tls->trackManager.reset(new SimTrackManager());
 
-  // Get DDCompactView, or would it be better to get the object from
-  // runManagerMaster instead of EventSetup in here?
+  // Get DDCompactView from the EventSetup. The pointer the master used in
+  // initG4 comes from an ESTransientHandle and may be released once the
+  // master world is built, so it cannot be handed over to the workers.
   edm::ESTransientHandle<DDCompactView> pDD;
   es.get<IdealGeometryRecord>().get(pDD);
 
@@ -60,6 +60,16 @@ class DigiAccumulatorMixMod {
     // Accumulate digis or other data for each pileup event, one at a time.
     virtual void accumulate(PileUpEventPrincipal const& event, edm::EventSetup const& setup, edm::StreamID const&) = 0;
 
+    // Concurrent accumulation of pileup events (concurrentAccumulation in the
+    // digitizer PSet, see MixingModule). The pileup products are read lazily
+    // and the secondary source does not serialize its reads, so an accumulator
+    // supporting it must read in prefetchPileUp every pileup product (and
+    // EventSetup data) its accumulate for pileup events uses. prefetchPileUp
+    // is called on the module thread just before that accumulate, which may
+    // then run concurrently with the other accumulators.
+    virtual bool canAccumulatePileUpConcurrently() const { return false; }
+    virtual void prefetchPileUp(PileUpEventPrincipal const& event, edm::EventSetup const& setup, edm::StreamID const&) {}
+
     // 1. Finalize digi collections or other data for each event.
     // 2. Put products in Event with appropriate instance labels
     virtual void finalizeEvent(edm::Event& event, edm::EventSetup const& setup) = 0;  // event is non-const
@@ -7,6 +7,9 @@
 #include <functional>
 #include <memory>
 
+#include "tbb/task_arena.h"
+#include "tbb/task_group.h"
+
 #include "MixingModule.h"
 #include "MixingWorker.h"
 #include "Adjuster.h"
@@ -230,6 +233,15 @@ namespace edm {
         std::unique_ptr<DigiAccumulatorMixMod> accumulator = std::unique_ptr<DigiAccumulatorMixMod>(DigiAccumulatorMixModFactory::get()->makeDigiAccumulator(pset, *this, iC));
         // Create appropriate DigiAccumulator
         if(accumulator.get() != nullptr) {
+          if(pset.getUntrackedParameter<bool>("concurrentAccumulation", false)) {
+            if(!accumulator->canAccumulatePileUpConcurrently()) {
+              throw cms::Exception("Configuration")
+                << "MixingModule: digitizer " << digiName << " does not support concurrentAccumulation\n";
+            }
+            concurrentAccumulators_.push_back(accumulator.get());
+          } else {
+            serialAccumulators_.push_back(accumulator.get());
+          }
           digiAccumulators_.push_back(accumulator.release());
         }
     }
@@ -598,9 +610,32 @@ namespace edm {
 
   void
   MixingModule::accumulateEvent(PileUpEventPrincipal const& event, edm::EventSetup const& setup, edm::StreamID const& streamID) {
-    for(Accumulators::const_iterator accItr = digiAccumulators_.begin(), accEnd = digiAccumulators_.end(); accItr != accEnd; ++accItr) {
-      (*accItr)->accumulate(event, setup, streamID);
+    if(concurrentAccumulators_.empty()) {
+      for(Accumulators::const_iterator accItr = digiAccumulators_.begin(), accEnd = digiAccumulators_.end(); accItr != accEnd; ++accItr) {
+        (*accItr)->accumulate(event, setup, streamID);
+      }
+      return;
+    }
+    // read the pileup products of the concurrent accumulators here: the
+    // secondary source does not serialize the (lazy) reads
+    for(auto accumulator : concurrentAccumulators_) {
+      accumulator->prefetchPileUp(event, setup, streamID);
     }
+    tbb::this_task_arena::isolate([&] {
+      tbb::task_group group;
+      for(auto accumulator : concurrentAccumulators_) {
+        group.run([&event, &setup, &streamID, accumulator] { accumulator->accumulate(event, setup, streamID); });
+      }
+      try {
+        for(auto accumulator : serialAccumulators_) {
+          accumulator->accumulate(event, setup, streamID);
+        }
+      } catch(...) {
+        group.wait();
+        throw;
+      }
+      group.wait();
+    });
   }
 
   void
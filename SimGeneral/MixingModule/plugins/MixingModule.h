@@ -102,6 +102,13 @@ namespace edm {
 
       // Digi-producing algorithms
       Accumulators digiAccumulators_ ;
+      // Split of digiAccumulators_ for the pileup events: the accumulators
+      // configured with concurrentAccumulation run as independent tasks
+      // while the others run in order on the module thread. Only accumulators
+      // that read their pileup products up front (prefetchPileUp) and do not
+      // use the random number engine in accumulate can be configured so.
+      Accumulators serialAccumulators_ ;
+      Accumulators concurrentAccumulators_ ;
 
   };
 }//edm
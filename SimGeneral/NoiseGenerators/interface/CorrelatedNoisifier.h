@@ -68,12 +68,16 @@ class CorrelatedNoisifier
 
       void checkOffDiagonal( const M& symCorMat ) ;
 
+      void fillLowerTriangle() ;
+
       mutable VecDou m_vecgau ;
 
       bool m_isDiagonal ;
       bool m_isIdentity ;
 
       M m_H ;
+
+      VecDou m_Hlow ; // strictly lower triangle of H, packed by rows
 };
 
 
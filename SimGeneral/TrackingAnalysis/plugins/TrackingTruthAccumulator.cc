@@ -377,6 +377,39 @@ void TrackingTruthAccumulator::accumulate( PileUpEventPrincipal const& event, ed
 	else edm::LogInfo(messageCategory_) << "Skipping pileup event for bunch crossing " << event.bunchCrossing();
 }
 
+void TrackingTruthAccumulator::prefetchPileUp( PileUpEventPrincipal const& event, edm::EventSetup const& setup, edm::StreamID const& )
+{
+	// read everything accumulate() uses for this pileup event, so that it
+	// only finds products that are already in memory (see DigiAccumulatorMixMod)
+	if( event.bunchCrossing()<-static_cast<int>(maximumPreviousBunchCrossing_) || event.bunchCrossing()>static_cast<int>(maximumSubsequentBunchCrossing_) ) return;
+
+	edm::Handle<std::vector<SimTrack> > hSimTracks;
+	edm::Handle<std::vector<SimVertex> > hSimVertices;
+	event.getByLabel( simTrackLabel_, hSimTracks );
+	event.getByLabel( simVertexLabel_, hSimVertices );
+
+	try
+	{
+		edm::Handle< std::vector<reco::GenParticle> > hGenParticles;
+		edm::Handle< std::vector<int> > hGenParticleIndices;
+		event.getByLabel( genParticleLabel_, hGenParticles );
+		event.getByLabel( genParticleLabel_, hGenParticleIndices );
+	}
+	catch( cms::Exception& exception )
+	{
+		// usually not available for pileup events, see accumulateEvent
+	}
+
+	for( const auto& collectionTag : collectionTags_ )
+	{
+		edm::Handle< std::vector<PSimHit> > hSimHits;
+		event.getByLabel( collectionTag, hSimHits );
+	}
+
+	edm::ESHandle<TrackerTopology> tTopoHandle;
+	setup.get<TrackerTopologyRcd>().get(tTopoHandle);
+}
+
 void TrackingTruthAccumulator::finalizeEvent( edm::Event& event, edm::EventSetup const& setup )
 {
 
@@ -78,6 +78,8 @@ private:
 	void initializeEvent( const edm::Event& event, const edm::EventSetup& setup ) override;
 	void accumulate( const edm::Event& event, const edm::EventSetup& setup ) override;
 	void accumulate( const PileUpEventPrincipal& event, const edm::EventSetup& setup, edm::StreamID const& ) override;
+	bool canAccumulatePileUpConcurrently() const override { return true; }
+	void prefetchPileUp( const PileUpEventPrincipal& event, const edm::EventSetup& setup, edm::StreamID const& ) override;
 	void finalizeEvent( edm::Event& event, const edm::EventSetup& setup ) override;
 
 	/** @brief Both forms of accumulate() delegate to this templated method. */
@@ -40,6 +40,7 @@
 // February, 2011: Time improvement in DriftDirection()  (J. Bashir Butt)
 // June, 2011: Bug Fix for pixels on ROC edges in module_killing_DB() (J. Bashir Butt)
 #include <iostream>
+#include <algorithm>
 
 #include "SimGeneral/NoiseGenerators/interface/GaussianTailNoiseGenerator.h"
 
@@ -1092,9 +1093,6 @@ void SiPixelDigitizerAlgorithm::induce_signal(const PSimHit& hit,
    typedef std::map< int, float, std::less<int> > hit_map_type;
    hit_map_type hit_signal;
 
-   // map to store pixel integrals in the x and in the y directions
-   std::map<int, float, std::less<int> > x,y;
-
    // Assign signals to readout channels and store sorted by channel number
 
    // Iterate over collection points on the collection plane
@@ -1169,86 +1167,36 @@ void SiPixelDigitizerAlgorithm::induce_signal(const PSimHit& hit,
      IPixLeftDownX = 0<IPixLeftDownX ? IPixLeftDownX : 0 ;
      IPixLeftDownY = 0<IPixLeftDownY ? IPixLeftDownY : 0 ;
 
-     x.clear(); // clear temporary integration array
-     y.clear();
-
-     // First integrate charge strips in x
-     int ix; // TT for compatibility
-     for (ix=IPixLeftDownX; ix<=IPixRightUpX; ix++) {  // loop over x index
-       float xUB, xLB, UpperBound, LowerBound;
-
-       // Why is set to 0 if ix=0, does it meen that we accept charge
-       // outside the sensor? CHeck How it was done in ORCA?
-       //if(ix == 0) LowerBound = 0.;
-       if(ix == 0 || SigmaX==0. )  // skip for surface segemnts
-	 LowerBound = 0.;
-       else {
-	 mp = MeasurementPoint( float(ix), 0.0);
-	 xLB = topol->localPosition(mp).x();
-	 LowerBound = 1-calcQ((xLB-CloudCenterX)/SigmaX);
-       }
-
-       if(ix == numRows-1 || SigmaX==0. )
-	 UpperBound = 1.;
-       else {
-	 mp = MeasurementPoint( float(ix+1), 0.0);
-	 xUB = topol->localPosition(mp).x();
-	 UpperBound = 1. - calcQ((xUB-CloudCenterX)/SigmaX);
-       }
-
-       float   TotalIntegrationRange = UpperBound - LowerBound; // get strip
-       x[ix] = TotalIntegrationRange; // save strip integral
-       //if(SigmaX==0 || SigmaY==0)
-       //cout<<TotalIntegrationRange<<" "<<ix<<std::endl;
-
-     }
+     // Integrate the charge strips in x and in y. Neighbouring pixels share
+     // an edge, so the Gaussian integral is evaluated once per pixel edge in
+     // a flat loop over a contiguous buffer and the strip integrals are the
+     // differences of consecutive edges.
+     int nx = IPixRightUpX - IPixLeftDownX + 1;
+     int ny = IPixRightUpY - IPixLeftDownY + 1;
+     if (nx <= 0 || ny <= 0) continue;
 
-    // Now integrate strips in y
-    int iy; // TT for compatibility
-    for (iy=IPixLeftDownY; iy<=IPixRightUpY; iy++) { //loope over y ind
-      float yUB, yLB, UpperBound, LowerBound;
-
-      if(iy == 0 || SigmaY==0.)
-	LowerBound = 0.;
-      else {
-        mp = MeasurementPoint( 0.0, float(iy) );
-        yLB = topol->localPosition(mp).y();
-	LowerBound = 1. - calcQ((yLB-CloudCenterY)/SigmaY);
-      }
-
-      if(iy == numColumns-1 || SigmaY==0. )
-	UpperBound = 1.;
-      else {
-        mp = MeasurementPoint( 0.0, float(iy+1) );
-        yUB = topol->localPosition(mp).y();
-	UpperBound = 1. - calcQ((yUB-CloudCenterY)/SigmaY);
-      }
-
-      float   TotalIntegrationRange = UpperBound - LowerBound;
-      y[iy] = TotalIntegrationRange; // save strip integral
-      //if(SigmaX==0 || SigmaY==0)
-      //cout<<TotalIntegrationRange<<" "<<iy<<std::endl;
-    }
+     stripIntegrals(topol, true, IPixLeftDownX, nx, numRows, CloudCenterX, SigmaX, x_);
+     stripIntegrals(topol, false, IPixLeftDownY, ny, numColumns, CloudCenterY, SigmaY, y_);
 
     // Get the 2D charge integrals by folding x and y strips
-    int chan;
-    for (ix=IPixLeftDownX; ix<=IPixRightUpX; ix++) {  // loop over x index
-      for (iy=IPixLeftDownY; iy<=IPixRightUpY; iy++) { //loope over y ind
+    for (int kx = 0; kx < nx; ++kx) {  // loop over x index
+      int ix = IPixLeftDownX + kx;
+      float ChargeX = Charge*x_[kx];
+      for (int ky = 0; ky < ny; ++ky) { //loope over y ind
+        int iy = IPixLeftDownY + ky;
 
-        float ChargeFraction = Charge*x[ix]*y[iy];
+        float ChargeFraction = ChargeX*y_[ky];
 
         if( ChargeFraction > 0. ) {
-	  chan = PixelDigi::pixelToChannel( ix, iy);  // Get index
+	  int chan = PixelDigi::pixelToChannel( ix, iy);  // Get index
           // Load the amplitude
           hit_signal[chan] += ChargeFraction;
 	} // endif
 
-
+#ifdef TP_DEBUG
 	mp = MeasurementPoint( float(ix), float(iy) );
 	LocalPoint lp = topol->localPosition(mp);
-	chan = topol->channel(lp);
-
-#ifdef TP_DEBUG
+	int chan = topol->channel(lp);
 	LogDebug ("Pixel Digitizer")
 	  << " pixel " << ix << " " << iy << " - "<<" "
 	  << chan << " " << ChargeFraction<<" "
@@ -1298,6 +1246,41 @@ void SiPixelDigitizerAlgorithm::induce_signal(const PSimHit& hit,
 
 } // end induce_signal
 
+//*************************************************************************
+// Charge fractions collected by the n pixels starting at first along one
+// axis (rows if alongX, columns otherwise) for a Gaussian cloud at center
+// with the given sigma. The first edge of the sensor collects everything
+// below it and the last one everything above it, a zero sigma puts the
+// full charge in every strip.
+void SiPixelDigitizerAlgorithm::stripIntegrals(const PixelTopology* topol,
+                                               bool alongX, int first, int n, int nPixels,
+                                               float center, float sigma,
+                                               std::vector<float>& integrals) {
+  integrals.resize(n);
+  if (sigma == 0.) {
+    std::fill(integrals.begin(), integrals.end(), 1.f);
+    return;
+  }
+
+  // n+1 edges, edge k is the lower bound of pixel first+k
+  edges_.resize(n+1);
+  float* __restrict__ edge = edges_.data();
+  int kmin = (first == 0) ? 1 : 0;
+  int kmax = (first+n == nPixels) ? n : n+1;
+  for (int k = kmin; k < kmax; ++k) {
+    float pos = alongX ? topol->localPosition(MeasurementPoint(float(first+k), 0.0)).x()
+                       : topol->localPosition(MeasurementPoint(0.0, float(first+k))).y();
+    edge[k] = (pos-center)/sigma;
+  }
+  for (int k = kmin; k < kmax; ++k)
+    edge[k] = 1. - calcQ(edge[k]);
+  if (kmin == 1) edge[0] = 0.;
+  if (kmax == n) edge[n] = 1.;
+
+  for (int k = 0; k < n; ++k)
+    integrals[k] = edge[k+1] - edge[k]; // save strip integral
+}
+
 /***********************************************************************/
 
 // Build pixels, check threshold, add misscalibration, ...
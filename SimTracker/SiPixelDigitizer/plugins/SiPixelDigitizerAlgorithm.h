@@ -32,6 +32,7 @@ class GaussianTailNoiseGenerator;
 class PixelDigi;
 class PixelDigiSimLink;
 class PixelGeomDetUnit;
+class PixelTopology;
 class SiG4UniversalFluctuation;
 class SiPixelFedCablingMap;
 class SiPixelGainCalibrationOfflineSimService;
@@ -284,6 +285,10 @@ class SiPixelDigitizerAlgorithm  {
     // Contains the accumulated hit info.
     signalMaps _signal;
 
+    // Scratch buffers for induce_signal, reused across collection points:
+    // the strip integrals in x and y and the integrated pixel edges.
+    std::vector<float> x_, y_, edges_;
+
     const bool makeDigiSimLinks_;
 
     const bool use_ineff_from_db_;
@@ -398,6 +403,10 @@ class SiPixelDigitizerAlgorithm  {
 		       const unsigned int tofBin,
                        const PixelGeomDetUnit *pixdet,
                        const std::vector<SignalPoint>& collection_points);
+    void stripIntegrals(const PixelTopology* topol,
+                        bool alongX, int first, int n, int nPixels,
+                        float center, float sigma,
+                        std::vector<float>& integrals);
     void fluctuateEloss(int particleId, float momentum, float eloss, 
 			float length, int NumberOfSegments,
 			float elossVector[],
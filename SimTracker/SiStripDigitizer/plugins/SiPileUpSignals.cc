@@ -1,6 +1,8 @@
 #include "SimTracker/SiStripDigitizer/interface/SiPileUpSignals.h"
 #include "SimDataFormats/TrackingHit/interface/PSimHit.h"
 
+#include <iterator>
+
 void SiPileUpSignals::resetSignals(){
   signal_.clear();
 }
@@ -8,12 +10,16 @@ void SiPileUpSignals::resetSignals(){
 void SiPileUpSignals::add(uint32_t detID, const std::vector<float>& locAmpl,
                           const size_t& firstChannelWithSignal, const size_t& lastChannelWithSignal) {
   SignalMapType& theSignal = signal_[detID];
+  // the channels come in increasing order: walk the map along with them
+  // instead of looking each of them up
+  SignalMapType::iterator where = theSignal.lower_bound(firstChannelWithSignal);
   for (size_t iChannel=firstChannelWithSignal; iChannel<lastChannelWithSignal; ++iChannel) {
     if(locAmpl[iChannel] != 0.0) {
-      if(theSignal.find(iChannel) == theSignal.end()) {
-        theSignal.insert(std::make_pair(iChannel, locAmpl[iChannel]));
+      while(where != theSignal.end() && where->first < int(iChannel)) ++where;
+      if(where != theSignal.end() && where->first == int(iChannel)) {
+        where->second += locAmpl[iChannel];
       } else {
-        theSignal[iChannel] += locAmpl[iChannel];
+        where = std::next(theSignal.emplace_hint(where, iChannel, locAmpl[iChannel]));
       }
     }
   }
@@ -165,7 +165,10 @@ SiStripDigitizerAlgorithm::accumulateSimHits(std::vector<PSimHit>::const_iterato
 
   float langle = (lorentzAngleHandle.isValid()) ? lorentzAngleHandle->getLorentzAngle(detID) : 0.;
 
-  std::vector<float> locAmpl(numStrips, 0.);
+  // only the strips in [thisFirstChannelWithSignal, thisLastChannelWithSignal)
+  // are touched below, and are reset to zero once added to the pile-up signals
+  std::vector<float>& locAmpl = locAmpl_;
+  locAmpl.resize(numStrips, 0.);
 
   // Loop over hits
 
@@ -174,7 +177,7 @@ SiStripDigitizerAlgorithm::accumulateSimHits(std::vector<PSimHit>::const_iterato
   if(CLHEP::RandFlat::shoot(engine) > inefficiency) {
     AssociationInfoForChannel* pDetIDAssociationInfo; // I only need this if makeDigiSimLinks_ is true...
     if( makeDigiSimLinks_ ) pDetIDAssociationInfo=&(associationInfoForDetId_[detId]); // ...so only search the map if that is the case
-    std::vector<float> previousLocalAmplitude; // Only used if makeDigiSimLinks_ is true. Needed to work out the change in amplitude.
+    std::vector<float>& previousLocalAmplitude = previousLocAmpl_; // Only used if makeDigiSimLinks_ is true. Needed to work out the change in amplitude.
 
     size_t simHitGlobalIndex=inputBeginGlobalIndex; // This needs to stored to create the digi-sim link later
     for (std::vector<PSimHit>::const_iterator simHitIter = inputBegin; simHitIter != inputEnd; ++simHitIter, ++simHitGlobalIndex ) {
@@ -184,7 +187,7 @@ SiStripDigitizerAlgorithm::accumulateSimHits(std::vector<PSimHit>::const_iterato
       }
       // check TOF
       if (std::fabs(simHitIter->tof() - cosmicShift - det->surface().toGlobal(simHitIter->localPosition()).mag()/30.) < tofCut && simHitIter->energyLoss()>0) {
-        if( makeDigiSimLinks_ ) previousLocalAmplitude=locAmpl; // Not needed except to make the sim link association.
+        if( makeDigiSimLinks_ ) previousLocalAmplitude.assign(locAmpl.begin(), locAmpl.end()); // Not needed except to make the sim link association.
         size_t localFirstChannel = numStrips;
         size_t localLastChannel  = 0;
         // process the hit
@@ -194,7 +197,8 @@ SiStripDigitizerAlgorithm::accumulateSimHits(std::vector<PSimHit>::const_iterato
         if(thisLastChannelWithSignal < localLastChannel) thisLastChannelWithSignal = localLastChannel;
 
         if( makeDigiSimLinks_ ) { // No need to do any of this if truth association was turned off in the configuration
-          for( size_t stripIndex=0; stripIndex<locAmpl.size(); ++stripIndex ) {
+          // this SimHit only changed the strips in [localFirstChannel, localLastChannel)
+          for( size_t stripIndex=localFirstChannel; stripIndex<localLastChannel; ++stripIndex ) {
             // Work out the amplitude from this SimHit from the difference of what it was before and what it is now
             float signalFromThisSimHit=locAmpl[stripIndex]-previousLocalAmplitude[stripIndex];
             if( signalFromThisSimHit!=0 ) { // If this SimHit had any contribution I need to record it.
@@ -219,6 +223,9 @@ SiStripDigitizerAlgorithm::accumulateSimHits(std::vector<PSimHit>::const_iterato
     } // end for
   }
   theSiPileUpSignals->add(detID, locAmpl, thisFirstChannelWithSignal, thisLastChannelWithSignal);
+  if(thisFirstChannelWithSignal < thisLastChannelWithSignal) {
+    std::fill(locAmpl.begin()+thisFirstChannelWithSignal, locAmpl.begin()+thisLastChannelWithSignal, 0.f);
+  }
 
   if(firstChannelsWithSignal[detID] > thisFirstChannelWithSignal) firstChannelsWithSignal[detID] = thisFirstChannelWithSignal;
   if(lastChannelsWithSignal[detID] < thisLastChannelWithSignal) lastChannelsWithSignal[detID] = thisLastChannelWithSignal;
@@ -279,7 +286,8 @@ SiStripDigitizerAlgorithm::digitize(
 
   const SiPileUpSignals::SignalMapType* theSignal(theSiPileUpSignals->getSignal(detID));  
 
-  std::vector<float> detAmpl(numStrips, 0.);
+  std::vector<float>& detAmpl = detAmpl_;
+  detAmpl.assign(numStrips, 0.);
   if(theSignal) {
     for(const auto& amp : *theSignal) {
       detAmpl[amp.first] = amp.second;
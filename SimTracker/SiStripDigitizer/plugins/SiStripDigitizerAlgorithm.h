@@ -146,6 +146,12 @@ class SiStripDigitizerAlgorithm {
   std::map<unsigned int, size_t> firstChannelsWithSignal;
   std::map<unsigned int, size_t> lastChannelsWithSignal;
 
+  // strip amplitude buffers reused from one module to the next, locAmpl_ is
+  // kept at zero outside of accumulateSimHits
+  std::vector<float> locAmpl_;
+  std::vector<float> previousLocAmpl_;
+  std::vector<float> detAmpl_;
+
   // ESHandles
   edm::ESHandle<SiStripLorentzAngle> lorentzAngleHandle;
 
@@ -3,6 +3,7 @@
 
 #include "TrackingTools/GsfTools/interface/MultiGaussianStateMerger.h"
 #include "TrackingTools/GsfTools/interface/DistanceBetweenComponents.h"
+#include "TrackingTools/GsfTools/interface/KullbackLeiblerDistance.h"
 #include "DataFormats/GeometryCommonDetAlgo/interface/DeepCopyPointerByClone.h"
 
 #include <map>
@@ -13,6 +14,9 @@
  *  which are close to one another. The actual calculation
  *  of the distance between components is done by a specific
  *  (polymorphic) class, given at construction time.
+ *  For the Kullback-Leibler distance the components are copied
+ *  to a structure of arrays and the distances of one component
+ *  to all the others are computed in a single (vectorized) loop.
  */
 
 template <unsigned int N>
@@ -53,6 +57,7 @@ private:
 
   int theMaxNumberOfComponents;
   DeepCopyPointerByClone< DistanceBetweenComponents<N> > theDistance;
+  bool theDistanceIsKL;
 
 };  
 
@@ -11,6 +11,7 @@
 #include "TrackingTools/TrajectoryState/interface/TrajectoryStateOnSurface.h"
 #include "TrackingTools/TrajectoryState/interface/FreeTrajectoryState.h"
 #include "TrackingTools/PatternTools/interface/TrajectoryStateUpdator.h"
+#include "TrackingTools/KalmanUpdators/interface/KFUpdator.h"
 #include "TrackingTools/PatternTools/interface/Trajectory.h"
 #include "TrackingTools/TrackFitters/interface/TrajectoryFitter.h"
 #include "TrackingTools/PatternTools/interface/TrajectoryMeasurement.h"
@@ -45,6 +46,7 @@ public:
     minHits_(minHits),
     owner(true){
     if(!theGeometry) theGeometry = &dummyGeometry;
+    theKFUpdator = dynamic_cast<const KFUpdator*>(theUpdator);
     // FIXME. Why this first constructor is needed? who is using it? Can it be removed?
     // it is uses in many many places
     }
@@ -64,6 +66,7 @@ public:
     minHits_(minHits),
     owner(false){
       if(!theGeometry) theGeometry = &dummyGeometry;
+      theKFUpdator = dynamic_cast<const KFUpdator*>(theUpdator);
     }
 
   ~KFTrajectoryFitter() override{
@@ -107,10 +110,17 @@ public:
 private:
   KFTrajectoryFitter(KFTrajectoryFitter const&) = delete;
 
+  // KFUpdator is final: calling it through its own type turns the per hit
+  // virtual dispatch into a direct call (KFUpdator::update itself is out of line)
+  TSOS update(const TSOS& predTsos, const TrackingRecHit& hit) const {
+    return theKFUpdator ? theKFUpdator->update(predTsos, hit) : theUpdator->update(predTsos, hit);
+  }
+
 
   static const DetLayerGeometry dummyGeometry;
   const Propagator* thePropagator;
   const TrajectoryStateUpdator* theUpdator;
+  const KFUpdator* theKFUpdator = nullptr; // theUpdator, if it is a KFUpdator
   const MeasurementEstimator* theEstimator;
   TkCloner const * theHitCloner=nullptr;
   const DetLayerGeometry* theGeometry;
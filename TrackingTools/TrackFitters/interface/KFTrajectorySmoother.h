@@ -10,6 +10,7 @@
 
 #include "TrackingTools/PatternTools/interface/TrajectorySmoother.h"
 #include "TrackingTools/PatternTools/interface/TrajectoryStateUpdator.h"
+#include "TrackingTools/KalmanUpdators/interface/KFUpdator.h"
 #include "TrackingTools/GeomPropagators/interface/Propagator.h"
 #include "TrackingTools/TrajectoryState/interface/TrajectoryStateOnSurface.h"
 #include "TrackingTools/TrajectoryState/interface/FreeTrajectoryState.h"
@@ -46,6 +47,7 @@ public:
       p = aPropagator.clone();
       p->setPropagationDirection(oppositeToMomentum);
       theOppositePropagator = p;
+      theKFUpdator = dynamic_cast<const KFUpdator*>(theUpdator);
     }
 
 
@@ -71,6 +73,7 @@ public:
       p = aPropagator->clone();
       p->setPropagationDirection(oppositeToMomentum);
       theOppositePropagator = p;
+      theKFUpdator = dynamic_cast<const KFUpdator*>(theUpdator);
     }
 
   ~KFTrajectorySmoother() override;
@@ -92,10 +95,16 @@ public:
 
 
 private:
+  // see KFTrajectoryFitter::update
+  TSOS update(const TSOS& predTsos, const TrackingRecHit& hit) const {
+    return theKFUpdator ? theKFUpdator->update(predTsos, hit) : theUpdator->update(predTsos, hit);
+  }
+
   const DetLayerGeometry dummyGeometry;
   const Propagator* theAlongPropagator;
   const Propagator* theOppositePropagator;
   const TrajectoryStateUpdator* theUpdator;
+  const KFUpdator* theKFUpdator = nullptr; // theUpdator, if it is a KFUpdator
   const MeasurementEstimator* theEstimator;
   TkCloner const * theHitCloner=nullptr;
   float theErrorRescaling;
@@ -121,7 +121,7 @@ Trajectory KFTrajectoryFitter::fitOne(const TrajectorySeed& aSeed,
 
 	  }else{
 	  LogTrace("TrackFitters") << "THE Precise HIT IS VALID: updating currTsos" << "\n";
-	  currTsos = updator()->update(predTsos, *preciseHit);
+	  currTsos = update(predTsos, *preciseHit);
 	  //check for valid hits with no det (refitter with constraints)
 	  bool badState = (!currTsos.isValid())
           || (hit.geographicalId().det() == DetId::Tracker
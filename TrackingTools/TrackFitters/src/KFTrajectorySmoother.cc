@@ -143,7 +143,7 @@ KFTrajectorySmoother::trajectory(const Trajectory& aTraj) const {
 	LogTrace("TrackFitters") << "THE Precise HIT IS VALID: updating currTsos" << "\n";
 	
 	//update backward predicted tsos with the hit
-	currTsos = updator()->update(predTsos, *preciseHit);
+	currTsos = update(predTsos, *preciseHit);
         if unlikely(!currTsos.isValid()) {
 	    currTsos = predTsos;
 	    edm::LogWarning("KFSmoother_UpdateFailed") << 